@@ -0,0 +1,100 @@
+#include "adaptivesampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+
+namespace
+{
+    struct Segment
+    {
+        double a, b;
+        double ya, yb;
+        int level;
+    };
+}
+
+AdaptiveSampler::AdaptiveSampler(double tolerance,
+                                 int maxLevel)
+    : tolerance(std::fabs(tolerance))
+    , maxLevel(std::max(maxLevel, 0))
+{}
+
+// Samples the interpolant over [sorted_x.front(), sorted_x.back()], returning x-values in ascending order.
+// Refinement starts from the uniform grid at seedDepth(depth), so it never begins denser than the grid it replaces.
+Interpolator::InterpolatedData AdaptiveSampler::sample(const Interpolant &interpolant,
+                                                       const std::vector<double> &sorted_x,
+                                                       int depth) const
+{
+    Interpolator::InterpolatedData data;
+    data.precision = interpolant.precision();
+    if (sorted_x.empty())
+        return data;
+
+    // Coarse uniform pass: nodes plus the seed split points
+    std::vector<double> x = Interpolator::denseGrid(sorted_x, seedDepth(depth));
+    std::vector<double> y(x.size());
+    interpolant.evaluate(x.data(), y.data(), x.size());
+
+    // The tolerance is relative to the height of the curve seen so far
+    auto range = std::minmax_element(y.begin(), y.end());
+    double span = *range.second - *range.first;
+    double threshold = tolerance * (span > 0.0 && std::isfinite(span) ? span : 1.0);
+
+    std::vector<Segment> pending;
+    pending.reserve(x.size());
+    for (size_t i = 0; i + 1 < x.size(); ++i)
+        pending.push_back({x[i], x[i + 1], y[i], y[i + 1], 0});
+
+    std::vector<Segment> refined;
+    std::vector<double> midX, midY;
+    while (!pending.empty()) {
+        // Evaluate every midpoint of this round in one batch
+        midX.resize(pending.size());
+        midY.resize(pending.size());
+        for (size_t i = 0; i < pending.size(); ++i)
+            midX[i] = 0.5 * (pending[i].a + pending[i].b);
+        interpolant.evaluate(midX.data(), midY.data(), midX.size());
+
+        refined.clear();
+        for (size_t i = 0; i < pending.size(); ++i) {
+            const Segment &segment = pending[i];
+            double error = std::fabs(midY[i] - 0.5 * (segment.ya + segment.yb));          // Distance from the chord
+
+            if (error <= threshold || !(midX[i] > segment.a && midX[i] < segment.b))
+                continue;           // Flat enough, or the interval cannot be split any further in double
+
+            x.push_back(midX[i]);
+            y.push_back(midY[i]);
+            if (segment.level < maxLevel) {
+                refined.push_back({segment.a, midX[i], segment.ya, midY[i], segment.level + 1});
+                refined.push_back({midX[i], segment.b, midY[i], segment.yb, segment.level + 1});
+            }
+        }
+        pending.swap(refined);
+    }
+
+    // Restore ascending x through an index permutation
+    std::vector<size_t> order(x.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return x[a] < x[b]; });
+
+    data.dense_x.resize(x.size());
+    data.dense_y.resize(y.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        data.dense_x[i] = x[order[i]];
+        data.dense_y[i] = y[order[i]];
+    }
+
+    return data;
+}
+
+// Seed depth for a slider depth. Four pieces per interval keep a wiggle symmetric about an interval's midpoint
+// from passing the chord test on the very first bisection, but shallower depths are honored so that large
+// tables do not get more samples than the uniform grid
+int AdaptiveSampler::seedDepth(int depth)
+{
+    return std::clamp(depth, 0, MaxSeedDepth);
+}
@@ -0,0 +1,31 @@
+#ifndef ADAPTIVESAMPLER_H
+#define ADAPTIVESAMPLER_H
+
+#include "interpolant.h"
+#include "interpolator.h"
+
+#include <vector>
+
+// Error-driven alternative to the uniform depth grid.
+// Every interval between nodes is bisected only while the midpoint strays from the chord through its ends
+// by more than the tolerance, so nearly linear stretches stay coarse and curved ones get refined.
+// Refinement runs breadth first, so each round evaluates all pending midpoints in one batch call.
+class AdaptiveSampler
+{
+public:
+    static constexpr double DefaultTolerance = 1e-3;            // Fraction of the y-range, below a pixel on the chart
+    static constexpr int DefaultMaxLevel = 12;
+    static constexpr int MaxSeedDepth = 3;          // Depth of the uniform seed grid once the slider allows it
+
+    AdaptiveSampler(double tolerance = DefaultTolerance, int maxLevel = DefaultMaxLevel);
+
+    Interpolator::InterpolatedData sample(const Interpolant &interpolant, const std::vector<double> &sorted_x,
+                                          int depth = MaxSeedDepth) const;
+    static int seedDepth(int depth);
+
+private:
+    double tolerance;
+    int maxLevel;           // Bisections allowed below the seed split of an interval
+};
+
+#endif //ADAPTIVESAMPLER_H
@@ -0,0 +1,221 @@
+#include "chebyshevinterpolant.h"
+#include "fft.h"
+#include "leastsquaresfit.h"
+#include "simdkernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+
+ChebyshevInterpolant::ChebyshevInterpolant(std::vector<double> coefficients,
+                                           double a,
+                                           double b)
+    : coeffs(std::move(coefficients))
+    , a(a)
+    , b(b)
+{
+    if (!(b > a))
+        throw std::invalid_argument("Chebyshev interval must have positive length");
+}
+
+// Builds the series from values sampled at nodes(values.size(), a, b)
+ChebyshevInterpolant ChebyshevInterpolant::fromSamples(const std::vector<double> &values,
+                                                       double a,
+                                                       double b)
+{
+    size_t n = values.size();
+    if (n == 0)
+        throw std::invalid_argument("No samples to build a Chebyshev series");
+
+    // c_j = (2 / n) * DCT-II(values)_j, with the constant term halved
+    std::vector<double> coefficients = Fft::dct2(values);
+    for (double &c : coefficients)
+        c *= 2.0 / n;
+    coefficients[0] *= 0.5;
+
+    return ChebyshevInterpolant(std::move(coefficients), a, b);
+}
+
+// Samples f at n Chebyshev points of [a, b] and builds the series through them
+ChebyshevInterpolant ChebyshevInterpolant::fromFunction(const std::function<double(double)> &f,
+                                                        double a,
+                                                        double b,
+                                                        size_t n)
+{
+    std::vector<double> points = nodes(n, a, b);
+    std::vector<double> values(n);
+    for (size_t k = 0; k < n; ++k)
+        values[k] = f(points[k]);
+
+    return fromSamples(values, a, b);
+}
+
+// Least-squares series of the given degree through points spanning [min x, max x], for noisy data where
+// passing through every point is wrong. The Chebyshev basis keeps the normal columns close to orthogonal,
+// and rows are folded into a blocked QR, O(n degree²). If residual is given it receives the RMS misfit.
+ChebyshevInterpolant ChebyshevInterpolant::fitLeastSquares(const std::vector<double> &x,
+                                                           const std::vector<double> &y,
+                                                           size_t degree,
+                                                           double *residual)
+{
+    if (x.size() != y.size())
+        throw std::invalid_argument("Incomplete point input");
+    if (x.size() < 2)
+        throw std::invalid_argument("Least-squares fitting needs at least two points");
+
+    auto [low, high] = std::minmax_element(x.begin(), x.end());
+    double a = *low;
+    double b = *high;
+    size_t p = std::min(degree, x.size() - 1) + 1;
+
+    // Rows T_0(t_i) ... T_{p-1}(t_i), gathered one block at a time
+    LeastSquaresFit fit(p);
+    std::vector<double> rows(LeastSquaresFit::BlockRows * p);
+    for (size_t first = 0; first < x.size(); first += LeastSquaresFit::BlockRows) {
+        size_t count = std::min(LeastSquaresFit::BlockRows, x.size() - first);
+        for (size_t i = 0; i < count; ++i) {
+            double t = (2.0 * x[first + i] - (a + b)) / (b - a);
+            double *row = &rows[i * p];
+            row[0] = 1.0;
+            if (p > 1)
+                row[1] = t;
+            for (size_t k = 2; k < p; ++k)
+                row[k] = 2.0 * t * row[k - 1] - row[k - 2];
+        }
+        fit.addRows(rows.data(), y.data() + first, count);
+    }
+
+    if (residual)
+        *residual = fit.residualNorm() / std::sqrt(static_cast<double>(x.size()));
+
+    return ChebyshevInterpolant(fit.solve(), a, b);
+}
+
+// Chebyshev points of the first kind on [a, b], cos(pi (k + 1/2) / n) mapped from [-1, 1] (descending)
+std::vector<double> ChebyshevInterpolant::nodes(size_t n,
+                                                double a,
+                                                double b)
+{
+    const double pi = std::acos(-1.0);
+    std::vector<double> points(n);
+    for (size_t k = 0; k < n; ++k)
+        points[k] = 0.5 * (a + b) + 0.5 * (b - a) * std::cos(pi * (k + 0.5) / n);
+
+    return points;
+}
+
+// Evaluates the series at x with the Clenshaw recurrence
+double ChebyshevInterpolant::evaluate(double x) const
+{
+    double t = (2.0 * x - (a + b)) / (b - a);
+    double next = 0.0;          // b_{k+1}
+    double afterNext = 0.0;         // b_{k+2}
+    for (size_t k = coeffs.size(); k-- > 1;) {
+        double current = coeffs[k] + 2.0 * t * next - afterNext;
+        afterNext = next;
+        next = current;
+    }
+
+    return coeffs.empty() ? 0.0 : coeffs[0] + t * next - afterNext;
+}
+
+// Evaluates count x-values with the vectorized Clenshaw kernel
+void ChebyshevInterpolant::evaluate(const double *x,
+                                    double *y,
+                                    size_t count) const
+{
+    Simd::evaluateChebyshev(coeffs.data(), coeffs.size(), a, b, x, y, count);
+}
+
+// First or second derivative at count x-values, a Clenshaw sum over the differentiated series
+void ChebyshevInterpolant::derivative(const double *x,
+                                      double *dy,
+                                      size_t count,
+                                      int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    std::vector<double> series = derivativeCoefficients(coeffs);
+    if (order == 2)
+        series = derivativeCoefficients(series);
+
+    Simd::evaluateChebyshev(series.data(), series.size(), a, b, x, dy, count);
+}
+
+// Definite integral from the antiderivative series:
+// int T_0 = T_1, int T_1 = T_2 / 4, int T_k = T_{k+1} / (2 (k + 1)) - T_{k-1} / (2 (k - 1))
+double ChebyshevInterpolant::integral(double from,
+                                      double to) const
+{
+    size_t n = coeffs.size();
+    std::vector<double> antiderivative(n + 1, 0.0);
+    for (size_t k = 1; k <= n; ++k) {
+        double previous = k == 1 ? 2.0 * coeffs[0] : coeffs[k - 1];
+        double next = k + 1 < n ? coeffs[k + 1] : 0.0;
+        antiderivative[k] = (previous - next) / (2.0 * k);
+    }
+    for (double &c : antiderivative)
+        c *= 0.5 * (b - a);         // dx = (b - a) / 2 dt
+
+    ChebyshevInterpolant primitive(std::move(antiderivative), a, b);
+
+    return primitive.evaluate(to) - primitive.evaluate(from);
+}
+
+// Exact integral of a polynomial through pointCount points over [a, b] (Clenshaw-Curtis):
+// sampling it at a power-of-two number of Chebyshev points no smaller than pointCount reproduces it exactly
+// as a Chebyshev series through the FFT-based DCT, and the series integrates in closed form
+double ChebyshevInterpolant::integratePolynomial(const Interpolant &polynomial,
+                                                 size_t pointCount,
+                                                 double a,
+                                                 double b)
+{
+    if (a == b)
+        return 0.0;
+    if (b < a)
+        return -integratePolynomial(polynomial, pointCount, b, a);
+
+    size_t n = Fft::nextPowerOfTwo(std::max<size_t>(pointCount, 2));
+    std::vector<double> points = nodes(n, a, b);
+    std::vector<double> values(n);
+    polynomial.evaluate(points.data(), values.data(), n);
+
+    return fromSamples(values, a, b).integral(a, b);
+}
+
+// Coefficients of the derivative of a series on [a, b]: d_{k-1} = d_{k+1} + 2 k c_k, with d_0 halved
+std::vector<double> ChebyshevInterpolant::derivativeCoefficients(const std::vector<double> &series) const
+{
+    size_t n = series.size();
+    if (n < 2)
+        return {0.0};
+
+    std::vector<double> derivative(n + 1, 0.0);
+    for (size_t k = n - 1; k >= 1; --k)
+        derivative[k - 1] = derivative[k + 1] + 2.0 * k * series[k];
+    derivative[0] *= 0.5;
+    derivative.resize(n - 1);
+
+    for (double &d : derivative)
+        d *= 2.0 / (b - a);         // dt/dx
+
+    return derivative;
+}
+
+const std::vector<double> &ChebyshevInterpolant::coefficients() const
+{
+    return coeffs;
+}
+
+double ChebyshevInterpolant::lower() const
+{
+    return a;
+}
+
+double ChebyshevInterpolant::upper() const
+{
+    return b;
+}
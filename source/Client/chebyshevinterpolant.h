@@ -0,0 +1,39 @@
+#ifndef CHEBYSHEVINTERPOLANT_H
+#define CHEBYSHEVINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <functional>
+#include <vector>
+
+// Truncated Chebyshev series sum c_k T_k(t) on [a, b], with t the point mapped onto [-1, 1].
+// Coefficients come from samples at Chebyshev points of the first kind via a DCT, and evaluation uses
+// the Clenshaw recurrence, which stays well conditioned where equispaced Lagrange does not.
+class ChebyshevInterpolant : public Interpolant
+{
+public:
+    ChebyshevInterpolant(std::vector<double> coefficients, double a, double b);
+    static ChebyshevInterpolant fromSamples(const std::vector<double> &values, double a, double b);
+    static ChebyshevInterpolant fromFunction(const std::function<double(double)> &f, double a, double b, size_t n);
+    static ChebyshevInterpolant fitLeastSquares(const std::vector<double> &x, const std::vector<double> &y, size_t degree,
+                                                double *residual = nullptr);
+    static std::vector<double> nodes(size_t n, double a, double b);
+    static double integratePolynomial(const Interpolant &polynomial, size_t pointCount, double a, double b);
+
+    double evaluate(double x) const override;
+    void evaluate(const double *x, double *y, size_t count) const override;
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+    double integral(double a, double b) const override;
+
+    const std::vector<double> &coefficients() const;
+    double lower() const;
+    double upper() const;
+
+private:
+    std::vector<double> coeffs;
+    double a, b;
+
+    std::vector<double> derivativeCoefficients(const std::vector<double> &series) const;
+};
+
+#endif //CHEBYSHEVINTERPOLANT_H
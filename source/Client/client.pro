@@ -2,6 +2,7 @@ QT += core gui network
 QT += core gui widgets
 QT += core gui widgets charts
 QT += printsupport
+QT += concurrent
 
 include($$PWD\QXlsx\QXlsx\QXlsx.pri)
 
@@ -12,21 +13,60 @@ CONFIG += c++17
 # DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 SOURCES += \
+    adaptivesampler.cpp \
+    chebyshevinterpolant.cpp \
     client.cpp \
     clientfuncs.cpp \
+    dataset.cpp \
+    fft.cpp \
+    fixedlagrange.cpp \
     forms.cpp \
+    gridgenerator.cpp \
+    incrementalinterpolant.cpp \
+    interpolant.cpp \
     interpolator.cpp \
+    leastsquaresfit.cpp \
+    localinterpolant.cpp \
     loginform.cpp \
     main.cpp \
     homewindow.cpp \
+    newtoninterpolant.cpp \
+    outlierdetector.cpp \
+    parallelevaluator.cpp \
+    resultcache.cpp \
+    seriesinterpolant.cpp \
+    simdkernels.cpp \
+    splineinterpolant.cpp \
+    streaminginterpolant.cpp \
 
 HEADERS += \
+    adaptivesampler.h \
+    chebyshevinterpolant.h \
     client.h \
     clientfuncs.h \
+    dataset.h \
+    fft.h \
+    fixedlagrange.h \
     forms.h \
+    gridgenerator.h \
+    incrementalinterpolant.h \
+    interpolant.h \
     interpolator.h \
+    leastsquaresfit.h \
+    localinterpolant.h \
     loginform.h \
     homewindow.h \
+    newtoninterpolant.h \
+    outlierdetector.h \
+    parallelevaluator.h \
+    resultcache.h \
+    seriesinterpolant.h \
+    simdkernels.h \
+    splineinterpolant.h \
+    streaminginterpolant.h \
+
+DISTFILES += \
+    simdkernels.inc \
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
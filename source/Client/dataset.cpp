@@ -0,0 +1,109 @@
+#include "dataset.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+
+// Shortest readable form of a value for error messages
+static std::string format(double value)
+{
+    std::ostringstream stream;
+    stream << value;
+
+    return stream.str();
+}
+
+// Takes ownership of the columns and validates them; throws std::invalid_argument naming the first offending row
+Dataset::Dataset(std::vector<double> x,
+                 std::vector<std::vector<double>> y_columns,
+                 bool allowDuplicates)
+    : xs(std::move(x))
+    , ys(std::move(y_columns))
+{
+    if (ys.empty())
+        throw std::invalid_argument("No Y values to interpolate");
+
+    size_t n = xs.size();
+    for (const std::vector<double> &column : ys)
+        if (column.size() != n)
+            throw std::invalid_argument("Incomplete point input");
+
+    for (size_t i = 0; i < n; ++i) {
+        bool finite = std::isfinite(xs[i]);
+        for (size_t s = 0; s < ys.size() && finite; ++s)
+            finite = std::isfinite(ys[s][i]);
+        if (!finite)
+            throw std::invalid_argument("Row " + std::to_string(i + 1) + " contains a value that is not a finite number");
+    }
+
+    permutation.resize(n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    presorted = std::is_sorted(xs.begin(), xs.end());
+    if (!presorted) {
+        std::stable_sort(permutation.begin(), permutation.end(), [&](size_t a, size_t b) { return xs[a] < xs[b]; });
+
+        sortedXs.resize(n);
+        for (size_t i = 0; i < n; ++i)
+            sortedXs[i] = xs[permutation[i]];
+        sortedYs.assign(ys.size(), std::vector<double>(n));
+        for (size_t s = 0; s < ys.size(); ++s)
+            for (size_t i = 0; i < n; ++i)
+                sortedYs[s][i] = ys[s][permutation[i]];
+    }
+
+    const std::vector<double> &sorted = sortedX();
+    if (!allowDuplicates)
+        for (size_t i = 1; i < n; ++i)
+            if (sorted[i] == sorted[i - 1])
+                throw std::invalid_argument("Duplicate X value '" + format(sorted[i]) + "' in rows "
+                                            + std::to_string(permutation[i - 1] + 1) + " and " + std::to_string(permutation[i] + 1)
+                                            + ". Interpolation requires unique X values.");
+}
+
+size_t Dataset::size() const
+{
+    return xs.size();
+}
+
+// Number of y columns, the main one included
+size_t Dataset::seriesCount() const
+{
+    return ys.size();
+}
+
+// True if the rows already came in ascending x, so no sorting took place
+bool Dataset::wasSorted() const
+{
+    return presorted;
+}
+
+const std::vector<double> &Dataset::x() const
+{
+    return xs;
+}
+
+const std::vector<double> &Dataset::y(size_t series) const
+{
+    return ys.at(series);
+}
+
+// Ascending x; input already in order is handed out as is rather than copied
+const std::vector<double> &Dataset::sortedX() const
+{
+    return presorted ? xs : sortedXs;
+}
+
+const std::vector<double> &Dataset::sortedY(size_t series) const
+{
+    return presorted ? ys.at(series) : sortedYs.at(series);
+}
+
+const std::vector<size_t> &Dataset::order() const
+{
+    return permutation;
+}
@@ -0,0 +1,36 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <cstddef>
+#include <vector>
+
+// Points validated once at ingestion and stored as structure-of-arrays, one contiguous array per column.
+// Construction checks every value for NaN or infinity, orders the rows through an index permutation
+// (skipped when x already ascends) and finds duplicate x-values next to each other in that order,
+// O(n log n) in total; downstream code can take the sorted columns as they are.
+class Dataset
+{
+public:
+    Dataset() = default;
+    Dataset(std::vector<double> x, std::vector<std::vector<double>> y_columns, bool allowDuplicates = false);
+
+    size_t size() const;
+    size_t seriesCount() const;
+    bool wasSorted() const;
+
+    const std::vector<double> &x() const;
+    const std::vector<double> &y(size_t series = 0) const;
+    const std::vector<double> &sortedX() const;
+    const std::vector<double> &sortedY(size_t series = 0) const;
+    const std::vector<size_t> &order() const;
+
+private:
+    std::vector<double> xs;         // Input order
+    std::vector<std::vector<double>> ys;
+    std::vector<double> sortedXs;           // Ascending x, ties kept in input order; empty when presorted
+    std::vector<std::vector<double>> sortedYs;
+    std::vector<size_t> permutation;            // Input index of each sorted row
+    bool presorted = true;
+};
+
+#endif //DATASET_H
@@ -0,0 +1,104 @@
+#include "fft.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+
+// Checks whether n is a positive power of two
+bool Fft::isPowerOfTwo(size_t n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// Smallest power of two not below n
+size_t Fft::nextPowerOfTwo(size_t n)
+{
+    size_t result = 1;
+    while (result < n)
+        result <<= 1;
+
+    return result;
+}
+
+// In-place iterative Cooley-Tukey FFT; the inverse is scaled by 1/n
+void Fft::transform(std::vector<std::complex<double>> &data,
+                    bool inverse)
+{
+    size_t n = data.size();
+    if (n <= 1)
+        return;
+    if (!isPowerOfTwo(n))
+        throw std::invalid_argument("FFT length must be a power of two");
+
+    // Bit-reversal permutation
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(data[i], data[j]);
+    }
+
+    // Butterflies, twiddles taken from a per-level table to limit rounding drift
+    const double pi = std::acos(-1.0);
+    std::vector<std::complex<double>> twiddles;
+    for (size_t length = 2; length <= n; length <<= 1) {
+        size_t half = length / 2;
+        double angle = (inverse ? 2.0 : -2.0) * pi / length;
+        twiddles.resize(half);
+        for (size_t k = 0; k < half; ++k)
+            twiddles[k] = std::polar(1.0, angle * k);
+
+        for (size_t start = 0; start < n; start += length) {
+            for (size_t k = 0; k < half; ++k) {
+                std::complex<double> even = data[start + k];
+                std::complex<double> odd = data[start + k + half] * twiddles[k];
+                data[start + k] = even + odd;
+                data[start + k + half] = even - odd;
+            }
+        }
+    }
+
+    if (inverse)
+        for (auto &value : data)
+            value /= static_cast<double>(n);
+}
+
+// Unnormalized DCT-II, X_j = sum_k x_k cos(pi j (2k + 1) / (2n)).
+// Power-of-two lengths go through one complex FFT of the even/odd reordered input (O(n log n)),
+// other lengths fall back to the direct O(n²) sum.
+std::vector<double> Fft::dct2(const std::vector<double> &input)
+{
+    size_t n = input.size();
+    std::vector<double> output(n, 0.0);
+    if (n == 0)
+        return output;
+
+    const double pi = std::acos(-1.0);
+
+    if (!isPowerOfTwo(n)) {
+        for (size_t j = 0; j < n; ++j)
+            for (size_t k = 0; k < n; ++k)
+                output[j] += input[k] * std::cos(pi * j * (2.0 * k + 1.0) / (2.0 * n));
+
+        return output;
+    }
+
+    // Even samples ascending, odd samples descending
+    std::vector<std::complex<double>> v(n);
+    for (size_t k = 0; k < n / 2; ++k) {
+        v[k] = input[2 * k];
+        v[n - 1 - k] = input[2 * k + 1];
+    }
+    if (n == 1)
+        v[0] = input[0];
+
+    transform(v);
+
+    for (size_t j = 0; j < n; ++j)
+        output[j] = (v[j] * std::polar(1.0, -pi * j / (2.0 * n))).real();
+
+    return output;
+}
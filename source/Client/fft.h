@@ -0,0 +1,18 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+// Radix-2 transforms shared by the spectral engines
+namespace Fft
+{
+    bool isPowerOfTwo(size_t n);
+    size_t nextPowerOfTwo(size_t n);
+
+    void transform(std::vector<std::complex<double>> &data, bool inverse = false);
+    std::vector<double> dct2(const std::vector<double> &input);
+}
+
+#endif //FFT_H
@@ -0,0 +1,75 @@
+#include "fixedlagrange.h"
+
+
+namespace
+{
+    using Factory = std::shared_ptr<const Interpolant> (*)(const double *x, const double *y);
+    using Kernel = void (*)(const double *x_points, const double *y_points, const double *x, double *y, size_t count);
+
+    template <size_t N>
+    std::shared_ptr<const Interpolant> createFixed(const double *x,
+                                                   const double *y)
+    {
+        return std::make_shared<FixedLagrangeInterpolant<N>>(x, y);
+    }
+
+    // Builds the kernel on the stack, so evaluation through it never allocates
+    template <size_t N>
+    void evaluateFixed(const double *x_points,
+                       const double *y_points,
+                       const double *x,
+                       double *y,
+                       size_t count)
+    {
+        FixedLagrangeInterpolant<N>(x_points, y_points).evaluate(x, y, count);
+    }
+
+    // Dispatch tables indexed by N - MinPoints, one instantiation per supported size
+    template <size_t... I>
+    constexpr std::array<Factory, sizeof...(I)> factoryTable(std::index_sequence<I...>)
+    {
+        return {{&createFixed<FixedLagrange::MinPoints + I>...}};
+    }
+
+    template <size_t... I>
+    constexpr std::array<Kernel, sizeof...(I)> kernelTable(std::index_sequence<I...>)
+    {
+        return {{&evaluateFixed<FixedLagrange::MinPoints + I>...}};
+    }
+
+    constexpr size_t TableSize = FixedLagrange::MaxPoints - FixedLagrange::MinPoints + 1;
+    constexpr std::array<Factory, TableSize> Factories = factoryTable(std::make_index_sequence<TableSize>());
+    constexpr std::array<Kernel, TableSize> Kernels = kernelTable(std::make_index_sequence<TableSize>());
+
+    bool supported(size_t n)
+    {
+        return n >= FixedLagrange::MinPoints && n <= FixedLagrange::MaxPoints;
+    }
+}
+
+// Returns the specialized interpolant for x.size() points, or nullptr when no kernel covers that size
+std::shared_ptr<const Interpolant> FixedLagrange::create(const std::vector<double> &x,
+                                                         const std::vector<double> &y)
+{
+    if (x.size() != y.size() || !supported(x.size()))
+        return nullptr;
+
+    return Factories[x.size() - MinPoints](x.data(), y.data());
+}
+
+// Evaluates the Lagrange polynomial through n points at count x-values.
+// Returns false without touching y when n has no specialized kernel.
+bool FixedLagrange::evaluate(const double *x_points,
+                             const double *y_points,
+                             size_t n,
+                             const double *x,
+                             double *y,
+                             size_t count)
+{
+    if (!supported(n))
+        return false;
+
+    Kernels[n - MinPoints](x_points, y_points, x, y, count);
+
+    return true;
+}
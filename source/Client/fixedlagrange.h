@@ -0,0 +1,92 @@
+#ifndef FIXEDLAGRANGE_H
+#define FIXEDLAGRANGE_H
+
+#include "interpolant.h"
+#include "simdkernels.h"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Lagrange form specialized on the point count N at compile time.
+// The denominators prod(x_i - x_j) are folded into the values once at construction, and each evaluation
+// builds the numerators from prefix and suffix products of (x - x_j), so there is no j != i branch, no division
+// and every loop has a constant trip count the compiler unrolls completely.
+template <size_t N>
+class FixedLagrangeInterpolant : public Interpolant
+{
+public:
+    FixedLagrangeInterpolant(const double *x, const double *y)
+    {
+        for (size_t i = 0; i < N; ++i) {
+            double denominator = 1.0;
+            for (size_t j = 0; j < N; ++j)
+                if (j != i)
+                    denominator *= x[i] - x[j];
+
+            xi[i] = x[i];
+            yi[i] = y[i];
+            wi[i] = 1.0 / denominator;
+            ci[i] = y[i] / denominator;
+        }
+    }
+
+    double evaluate(double x) const override
+    {
+        return evaluate(x, std::make_index_sequence<N>());
+    }
+
+    void evaluate(const double *x, double *y, size_t count) const override
+    {
+        for (size_t i = 0; i < count; ++i)
+            y[i] = evaluate(x[i], std::make_index_sequence<N>());
+    }
+
+    // Closed-form first or second derivative through the barycentric kernel, which the stored weights feed directly
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override
+    {
+        if (order != 1 && order != 2)
+            throw std::invalid_argument("Only first and second derivatives are supported");
+
+        Simd::evaluateBarycentricDerivatives(xi.data(), yi.data(), wi.data(), N, x,
+                                             order == 1 ? dy : nullptr, order == 2 ? dy : nullptr, count);
+    }
+
+private:
+    std::array<double, N> xi;
+    std::array<double, N> yi;
+    std::array<double, N> wi;           // Barycentric weights, the reciprocal basis denominators
+    std::array<double, N> ci;           // y_i divided by the basis denominator of node i
+
+    template <size_t... I>
+    double evaluate(double x, std::index_sequence<I...>) const
+    {
+        // prefix[i] = prod_{j<i} (x - x_j), suffix[i] = prod_{j>=i} (x - x_j)
+        std::array<double, N + 1> prefix;
+        std::array<double, N + 1> suffix;
+        prefix[0] = 1.0;
+        suffix[N] = 1.0;
+        for (size_t i = 0; i < N; ++i)
+            prefix[i + 1] = prefix[i] * (x - xi[i]);
+        for (size_t i = N; i > 0; --i)
+            suffix[i - 1] = suffix[i] * (x - xi[i - 1]);
+
+        // On a node every other term carries a zero factor, leaving ci[i] times the rounded product of (x_i - x_j), i.e. y_i up to rounding
+        return ((ci[I] * prefix[I] * suffix[I + 1]) + ...);
+    }
+};
+
+namespace FixedLagrange
+{
+    // Point counts that have a specialized kernel
+    constexpr size_t MinPoints = 3;
+    constexpr size_t MaxPoints = 16;
+
+    std::shared_ptr<const Interpolant> create(const std::vector<double> &x, const std::vector<double> &y);
+    bool evaluate(const double *x_points, const double *y_points, size_t n,
+                  const double *x, double *y, size_t count);
+}
+
+#endif //FIXEDLAGRANGE_H
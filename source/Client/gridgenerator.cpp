@@ -0,0 +1,72 @@
+#include "gridgenerator.h"
+#include "parallelevaluator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+
+GridGenerator::GridGenerator(std::shared_ptr<const Interpolant> interpolant,
+                             std::vector<double> sorted_x,
+                             int depth,
+                             size_t chunkSize)
+    : interpolant(std::move(interpolant))
+    , nodes(std::move(sorted_x))
+    , segments(static_cast<size_t>(std::max(depth, 0)) + 1)
+    , chunkSize(std::max<size_t>(chunkSize, 1))
+{
+    if (!this->interpolant)
+        throw std::invalid_argument("Grid generator needs an interpolant");
+}
+
+// Fills the next chunk (reusing its buffers) and returns false once the grid is exhausted
+bool GridGenerator::next(Chunk &chunk)
+{
+    size_t total = totalSize();
+    if (position >= total)
+        return false;
+
+    size_t count = std::min(chunkSize, total - position);
+    chunk.offset = position;
+    chunk.x.resize(count);
+    chunk.y.resize(count);
+
+    // Same arithmetic as Interpolator::denseGrid, so streamed and materialized grids agree bit for bit
+    for (size_t k = 0; k < count; ++k) {
+        size_t index = position + k;
+        size_t interval = index / segments;
+        if (interval + 1 >= nodes.size()) {
+            chunk.x[k] = nodes.back();          // The last x point completes the range
+            continue;
+        }
+
+        double start = nodes[interval];
+        double end = nodes[interval + 1];
+        int j = static_cast<int>(index % segments);
+        chunk.x[k] = start + (end - start) * j / static_cast<int>(segments);
+    }
+
+    ParallelEvaluator().evaluate(*interpolant, chunk.x.data(), chunk.y.data(), count);
+    position += count;
+
+    return true;
+}
+
+// Rewinds to the start of the grid
+void GridGenerator::reset()
+{
+    position = 0;
+}
+
+// Number of (x, y) pairs in the whole grid
+size_t GridGenerator::totalSize() const
+{
+    return nodes.empty() ? 0 : (nodes.size() - 1) * segments + 1;
+}
+
+// Grid size for pointCount sorted nodes subdivided depth times, known before anything is evaluated
+size_t GridGenerator::gridSize(size_t pointCount,
+                               int depth)
+{
+    return pointCount == 0 ? 0 : (pointCount - 1) * (static_cast<size_t>(std::max(depth, 0)) + 1) + 1;
+}
@@ -0,0 +1,40 @@
+#ifndef GRIDGENERATOR_H
+#define GRIDGENERATOR_H
+
+#include "interpolant.h"
+
+#include <memory>
+#include <vector>
+
+// Pull-based producer of the dense interpolation grid in fixed-size chunks of (x, y) pairs.
+// Consumers (plotting, XLSX export, file writers) call next() until it returns false, so memory stays
+// bounded by the chunk size instead of the full grid. The x-values match Interpolator::denseGrid exactly.
+class GridGenerator
+{
+public:
+    static constexpr size_t DefaultChunkSize = 8192;
+
+    struct Chunk
+    {
+        std::vector<double> x;
+        std::vector<double> y;
+        size_t offset = 0;          // Grid index of the first pair in the chunk
+    };
+
+    GridGenerator(std::shared_ptr<const Interpolant> interpolant, std::vector<double> sorted_x, int depth,
+                  size_t chunkSize = DefaultChunkSize);
+
+    bool next(Chunk &chunk);
+    void reset();
+    size_t totalSize() const;
+    static size_t gridSize(size_t pointCount, int depth);
+
+private:
+    std::shared_ptr<const Interpolant> interpolant;
+    std::vector<double> nodes;
+    size_t segments;
+    size_t chunkSize;
+    size_t position = 0;
+};
+
+#endif //GRIDGENERATOR_H
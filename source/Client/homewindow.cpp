@@ -1,18 +1,43 @@
 #include "homewindow.h"
+#include "adaptivesampler.h"
+#include "dataset.h"
 #include "interpolator.h"
+#include "newtoninterpolant.h"
 #include "ui_homewindow.h"
 #include "xlsxdocument.h"
 
+#include <QFile>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QMouseEvent>
+#include <QRegularExpression>
+#include <QSignalBlocker>
+#include <QStatusBar>
 #include <QTableWidgetItem>
+#include <QTextStream>
 #include <QVBoxLayout>
+#include <QWheelEvent>
 #include <QtCharts/QChartView>
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QValueAxis>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace QXlsx;
 
+// Quiet time after the last slider move or cell edit before the plot is recomputed
+static const int RecomputeDelayMs = 120;
+
+// Pixel columns a grid too large to hold is reduced to, at least; the chart width is used when it is wider
+static const int MinPlotColumns = 1024;
+
+// Rows an XLSX sheet can hold; larger exports are written as CSV instead
+static const size_t MaxSheetRows = 1048576;
+
+// Longest curve kept while watching a file, older samples scroll off the chart
+static const qsizetype MaxWatchedSamples = 200000;
 
 // Constructor: Initializes UI and connects UI elements to their respective slots
 HomeWindow::HomeWindow(QWidget *parent)
@@ -21,16 +46,62 @@ HomeWindow::HomeWindow(QWidget *parent)
 {
     ui->setupUi(this);
 
+    // Populate the interpolation method selector, the first entry is the default
+    ui->methodComboBox->addItem("Barycentric Lagrange", static_cast<int>(Interpolator::Method::Barycentric));
+    ui->methodComboBox->addItem("Classic Lagrange", static_cast<int>(Interpolator::Method::Lagrange));
+    ui->methodComboBox->addItem("Newton divided differences", static_cast<int>(Interpolator::Method::Newton));
+    ui->methodComboBox->addItem("Chebyshev (resampled)", static_cast<int>(Interpolator::Method::Chebyshev));
+    ui->methodComboBox->addItem("Local Lagrange (6 nearest points)", static_cast<int>(Interpolator::Method::LocalLagrange));
+    ui->methodComboBox->addItem("Natural cubic spline", static_cast<int>(Interpolator::Method::NaturalSpline));
+    ui->methodComboBox->addItem("Clamped cubic spline", static_cast<int>(Interpolator::Method::ClampedSpline));
+    ui->methodComboBox->addItem("Akima spline", static_cast<int>(Interpolator::Method::Akima));
+    ui->methodComboBox->addItem("Floater-Hormann rational", static_cast<int>(Interpolator::Method::FloaterHormann));
+    ui->methodComboBox->addItem("Least-squares fit (Chebyshev basis)", static_cast<int>(Interpolator::Method::LeastSquares));
+
+    // Rule used to flag suspicious rows, the first entry is the default
+    ui->outlierComboBox->addItem("Outliers: IQR fences", static_cast<int>(OutlierDetector::Rule::IQR));
+    ui->outlierComboBox->addItem("Outliers: MAD z-score", static_cast<int>(OutlierDetector::Rule::MAD));
+    connect(ui->outlierComboBox, &QComboBox::currentIndexChanged, this, [=]() {
+        outliers.setRule(static_cast<OutlierDetector::Rule>(ui->outlierComboBox->currentData().toInt()));
+    });
+
+    // The spin box holds the parameter of the methods that take one, reset to its default on every switch
+    connect(ui->methodComboBox, &QComboBox::currentIndexChanged, this, [=]() {
+        Interpolator::Method method = static_cast<Interpolator::Method>(ui->methodComboBox->currentData().toInt());
+        ui->parameterSpinBox->setEnabled(method == Interpolator::Method::FloaterHormann || method == Interpolator::Method::LeastSquares);
+        if (method == Interpolator::Method::FloaterHormann) {
+            ui->parameterSpinBox->setPrefix("Blending d = ");
+            ui->parameterSpinBox->setRange(0, 20);
+            ui->parameterSpinBox->setValue(static_cast<int>(Interpolator().blendingDegree()));
+        } else if (method == Interpolator::Method::LeastSquares) {
+            ui->parameterSpinBox->setPrefix("Fit degree = ");
+            ui->parameterSpinBox->setRange(1, 200);
+            ui->parameterSpinBox->setValue(static_cast<int>(Interpolator().fitDegree()));
+        }
+    });
+
     // Connect buttons and other widgets to their corresponding event handlers
     connect(ui->loadXLSXButton, &QPushButton::clicked, this, &HomeWindow::onImportXLSXClicked);
     connect(ui->inputTable, &QTableWidget::itemChanged, this, &HomeWindow::on_inputTable_itemChanged);
     connect(ui->clearButton, &QPushButton::clicked, this, &HomeWindow::onClearTableClicked);
     connect(ui->depthSlider, &QSlider::valueChanged, this, [=](int value) {
         ui->depthLabel->setText(QString("Depth: %1").arg(value));
+        scheduleRecompute(false);
     });
     connect(ui->interpolateButton, &QPushButton::clicked, this, &HomeWindow::onInterpolateClicked);
     connect(ui->saveGraphButton, &QPushButton::clicked, this, &HomeWindow::onSaveGraphClicked);
     connect(ui->saveXLSXButton, &QPushButton::clicked, this, &HomeWindow::onSaveXLSXClicked);
+    connect(ui->gridButton, &QPushButton::clicked, this, &HomeWindow::onInterpolateGridClicked);
+    connect(ui->watchButton, &QPushButton::toggled, this, &HomeWindow::onWatchToggled);
+    connect(&watcher, &QFileSystemWatcher::fileChanged, this, &HomeWindow::onWatchedFileChanged);
+
+    // Once something is plotted, slider moves and edits redraw it by themselves after a short pause
+    recomputeTimer.setSingleShot(true);
+    recomputeTimer.setInterval(RecomputeDelayMs);
+    connect(&recomputeTimer, &QTimer::timeout, this, &HomeWindow::onRecomputeTimeout);
+
+    // Wheel zoom, drag pan and double-click reset on the chart
+    ui->chartView->viewport()->installEventFilter(this);
 }
 
 // Destructor: Clean up UI
@@ -58,17 +129,21 @@ void HomeWindow::onImportXLSXClicked()
     // Clear current table contents
     ui->inputTable->clearContents();
     ui->inputTable->setRowCount(0);
+    resetLiveModel();
+
+    // One X column followed by as many Y columns as the first row fills
+    int columns = 2;
+    while (!xlsx.read(1, columns + 1).toString().isEmpty())
+        ++columns;
+    setSeriesColumns(columns);
 
     // Read rows until the first column is empty
     int row = 1;
     while (!xlsx.read(row, 1).toString().isEmpty()) {
         ui->inputTable->insertRow(ui->inputTable->rowCount());
 
-        QString x = xlsx.read(row, 1).toString();
-        QString y = xlsx.read(row, 2).toString();
-
-        ui->inputTable->setItem(row - 1, 0, new QTableWidgetItem(x));
-        ui->inputTable->setItem(row - 1, 1, new QTableWidgetItem(y));
+        for (int column = 1; column <= columns; ++column)
+            ui->inputTable->setItem(row - 1, column - 1, new QTableWidgetItem(xlsx.read(row, column).toString()));
 
         ++row;
     }
@@ -87,6 +162,10 @@ void HomeWindow::on_inputTable_itemChanged(QTableWidgetItem *item)
     int columnCount = ui->inputTable->columnCount();
     int lastRow = rowCount - 1;
 
+    // Feed the edited row into the live model as a single-point delta
+    syncRowPoint(item->row());
+    scheduleRecompute(true);
+
     // Check if last row is filled, if yes, add a new row
     bool isLastRowFilled = true;
     for (int col = 0; col < columnCount; ++col) {
@@ -114,8 +193,16 @@ void HomeWindow::on_inputTable_itemChanged(QTableWidgetItem *item)
         }
         if (isEmpty) {
             ++emptyRows;
-            if (emptyRows > 1)
+            if (emptyRows > 1) {
                 ui->inputTable->removeRow(row);
+
+                if (row < static_cast<int>(rowX.size())) {
+                    if (!std::isnan(rowX[row]) && !liveModel.remove(rowX[row]))
+                        liveModelValid = false;
+                    rowX.erase(rowX.begin() + row);
+                    rowY.erase(rowY.begin() + row);
+                }
+            }
         }
     }
 
@@ -144,49 +231,126 @@ void HomeWindow::onClearTableClicked()
 {
     ui->inputTable->clearContents();
     ui->inputTable->setRowCount(1);
+    setSeriesColumns(2);
+    resetLiveModel();
 }
 
 // Slot: Handles interpolation and graph plotting
 void HomeWindow::onInterpolateClicked()
 {
-    std::vector<double> x_points = getXValues();
-    std::vector<double> y_points = getYValues();
+    interpolateTable(true);
+}
+
+// Interpolates the table and plots the result. Only an explicit click (interactive) reports problems in a dialog
+// and warns about outliers; live recomputes skip a table that is mid-edit with a note in the status bar.
+void HomeWindow::interpolateTable(bool interactive)
+{
+    // A table plot replaces the live one, and covers any recompute still pending
+    ui->watchButton->setChecked(false);
+    recomputeTimer.stop();
+    tableEdited = false;
+
     int depth = ui->depthSlider->value();
 
-    // Require at least two data points
-    if (x_points.size() < 2) {
-        QMessageBox::warning(this, "Invalid Input", QString("Table has to contain 2 or more rows"));
+    auto report = [&](const QString &title, const QString &message) {
+        if (interactive)
+            QMessageBox::warning(this, title, message);
+        else
+            statusBar()->showMessage(QString("Live update skipped: %1").arg(message));
+    };
+
+    // Parse and validate the table once; repeated measurements are fine for a least-squares fit
+    bool fitting = static_cast<Interpolator::Method>(ui->methodComboBox->currentData().toInt()) == Interpolator::Method::LeastSquares;
+    Dataset dataset;
+    try {
+        dataset = readTable(fitting);
+    } catch (const std::exception &ex) {
+        report("Invalid Input", ex.what());
 
         return;
     }
 
-    // Check for duplicate x-values
-    std::vector<double> seen_x;
-    for (size_t i = 0; i < x_points.size(); ++i) {
-        double x = x_points[i];
-
-        if (std::find(seen_x.begin(), seen_x.end(), x) != seen_x.end()) {
-            QMessageBox::warning(this, "Invalid Input", QString("Duplicate X value '%1' detected. Interpolation requires unique X values.").arg(x));
+    // Require at least two data points
+    if (dataset.size() < 2) {
+        report("Invalid Input", QString("Table has to contain 2 or more rows"));
 
-            return;
-        }
-        seen_x.push_back(x);
+        return;
     }
 
     try {
-        Interpolator interp;
-        auto data = interp.computeInterpolatedData(x_points, y_points, depth);
-        auto lastDenseX = data.dense_x;
-        auto lastDenseY = data.dense_y;
+        Interpolator interp = selectedInterpolator();
+
+        // Cached results are keyed on the sorted dataset
+        const std::vector<double> &sorted_x = dataset.sortedX();
+        const std::vector<double> &sorted_y = dataset.sortedY();
+        uint64_t fingerprint = ResultCache::fingerprint(sorted_x, sorted_y);
+        int method = static_cast<int>(interp.method());
+        if (ui->parameterSpinBox->isEnabled())
+            method += ui->parameterSpinBox->value() << 8;           // Each parameter value gives a different interpolant
+
+        ResultCache::Key interpolantKey = {fingerprint, method, ResultCache::InterpolantDepth};
+        std::shared_ptr<const Interpolant> interpolant = resultCache.interpolant(interpolantKey);
+        if (!interpolant) {
+            // Table edits normally keep the barycentric weights current, so only the grid needs evaluating;
+            // the model is only trusted when it holds exactly the points being cached
+            if (!liveModelValid && interp.method() == Interpolator::Method::Barycentric)
+                rebuildLiveModel();
+            if (liveModelValid && interp.method() == Interpolator::Method::Barycentric && liveModel.matches(sorted_x, sorted_y))
+                interpolant = liveModel.snapshot();
+            else
+                interpolant = interp.createInterpolant(sorted_x, sorted_y);
+
+            resultCache.insert(interpolantKey, interpolant, sorted_x.size());
+        }
+
+        lastInterpolant = interpolant;
+        lastNodes = sorted_x;
+        lastDepth = depth;
+        lastAdaptive = ui->adaptiveCheckBox->isChecked();
+        lastData.reset();
+
+        if (interactive)
+            checkForOutliers(dataset.x(), dataset.y());
+
+        // Reuse the evaluated samples when this dataset was plotted before at the same depth;
+        // grids too large for the cache are streamed instead of materialized
+        ResultCache::Key dataKey = {fingerprint, method, lastAdaptive ? ResultCache::AdaptiveDepth - AdaptiveSampler::seedDepth(depth) : depth};
+        lastDataKey = dataKey;
+        size_t gridBytes = 2 * sizeof(double) * GridGenerator::gridSize(sorted_x.size(), depth);
+        if (lastAdaptive || gridBytes <= resultCache.capacity()) {
+            lastData = resultCache.data(dataKey);
+            if (!lastData) {
+                if (lastAdaptive)
+                    lastData = std::make_shared<const Interpolator::InterpolatedData>(AdaptiveSampler().sample(*lastInterpolant, lastNodes, depth));
+                else
+                    lastData = std::make_shared<const Interpolator::InterpolatedData>(Interpolator::evaluateOnGrid(*lastInterpolant, lastNodes, lastDepth));
+                resultCache.insert(dataKey, lastData);
+            }
+            plotGraph(*lastData);
+        } else {
+            GridGenerator grid(lastInterpolant, lastNodes, lastDepth);
+            plotGraph(grid, lastNodes.front(), lastNodes.back());
+        }
+
+        // Extra Y columns share the x-values, so they are interpolated together over one basis
+        lastSeries.reset();
+        std::vector<std::vector<double>> extraColumns;
+        for (size_t series = 1; series < dataset.seriesCount(); ++series)
+            extraColumns.push_back(dataset.sortedY(series));
+        if (!extraColumns.empty())
+            lastSeries = interp.createSeriesInterpolant(sorted_x, extraColumns);
+        plotExtraSeries();
 
-        checkForOutliers(x_points, y_points);
-        plotGraph(lastDenseX, lastDenseY);
+        statusBar()->showMessage(QString("Result cache: %1 hits, %2 misses, %3 entries")
+                                     .arg(resultCache.hits())
+                                     .arg(resultCache.misses())
+                                     .arg(resultCache.size()));
 
         // Enable save buttons
         ui->saveGraphButton->setEnabled(true);
         ui->saveXLSXButton->setEnabled(true);
     } catch (const std::exception &ex) {
-        QMessageBox::warning(this, "Interpolation Error", ex.what());
+        report("Interpolation Error", ex.what());
     }
 }
 
@@ -202,15 +366,79 @@ void HomeWindow::onSaveGraphClicked()
 // Slot: Saves interpolated data as XLSX
 void HomeWindow::onSaveXLSXClicked()
 {
+    if (!lastInterpolant)
+        return;
+
+    // A sheet past the row limit cannot be opened in Excel, and a Document holds every cell until it is saved,
+    // so such grids go to a CSV file written chunk by chunk instead
+    size_t rows = lastData ? lastData->dense_x.size() : GridGenerator::gridSize(lastNodes.size(), lastDepth);
+    if (rows > MaxSheetRows) {
+        QMessageBox::information(this, "Export", QString("%1 samples exceed the %2 rows of an XLSX sheet, so they will be saved as CSV.")
+                                                     .arg(rows)
+                                                     .arg(MaxSheetRows));
+        QString fileName = QFileDialog::getSaveFileName(this, "Save CSV", "output.csv", "CSV Files (*.csv)");
+        if (fileName.isEmpty())
+            return;
+
+        if (!saveCsv(fileName)) {
+            QMessageBox::warning(this, "Error", "Failed to save CSV file.");
+
+            return;
+        }
+
+        QMessageBox::information(this, "Export", "Interpolated data exported to CSV successfully.");
+
+        return;
+    }
+
     QString fileName = QFileDialog::getSaveFileName(this, "Save XLSX", "output.xlsx", "Excel Files (*.xlsx>");
     if (fileName.isEmpty())
         return;
 
     Document xlsx;
 
-    for (size_t i = 0; i < lastDenseX.size(); ++i) {
-        xlsx.write(i + 1, 1, lastDenseX[i]);
-        xlsx.write(i + 1, 2, lastDenseY[i]);
+    // Extra series go into the columns after the main Y column
+    size_t extraCount = lastSeries ? lastSeries->seriesCount() : 0;
+    std::vector<std::vector<double>> extraY;
+    auto writeExtras = [&](const double *x, size_t count, size_t firstRow) {
+        if (extraCount == 0)
+            return;
+
+        lastSeries->evaluate(x, count, extraY);
+        for (size_t s = 0; s < extraCount; ++s)
+            for (size_t i = 0; i < count; ++i)
+                xlsx.write(firstRow + i, 3 + s, extraY[s][i]);
+    };
+
+    if (lastData) {
+        // Export exactly the samples that were plotted
+        for (size_t i = 0; i < lastData->dense_x.size(); ++i) {
+            xlsx.write(i + 1, 1, lastData->dense_x[i]);
+            xlsx.write(i + 1, 2, lastData->dense_y[i]);
+        }
+        writeExtras(lastData->dense_x.data(), lastData->dense_x.size(), 1);
+    } else {
+        // Grid not kept in memory, e.g. under a small cache, but within the sheet limit; pull it chunk by chunk
+        GridGenerator grid(lastInterpolant, lastNodes, lastDepth);
+        GridGenerator::Chunk chunk;
+        while (grid.next(chunk)) {
+            for (size_t i = 0; i < chunk.x.size(); ++i) {
+                xlsx.write(chunk.offset + i + 1, 1, chunk.x[i]);
+                xlsx.write(chunk.offset + i + 1, 2, chunk.y[i]);
+            }
+            writeExtras(chunk.x.data(), chunk.x.size(), chunk.offset + 1);
+        }
+    }
+
+    // A Newton fit is also saved in coefficient form, enough to evaluate it later without the raw points
+    if (auto newton = std::dynamic_pointer_cast<const NewtonInterpolant>(lastInterpolant)) {
+        int column = 4 + static_cast<int>(extraCount);
+        xlsx.write(1, column, "Newton centers");
+        xlsx.write(1, column + 1, "Newton coefficients");
+        for (size_t i = 0; i < newton->coefficients().size(); ++i) {
+            xlsx.write(i + 2, column, newton->centers()[i]);
+            xlsx.write(i + 2, column + 1, newton->coefficients()[i]);
+        }
     }
 
     if (!xlsx.saveAs(fileName)) {
@@ -222,58 +450,502 @@ void HomeWindow::onSaveXLSXClicked()
     QMessageBox::information(this, "Export", "Interpolated data exported to XLSX successfully.");
 }
 
+// Slot: Interpolates a gridded surface from an XLSX sheet (x across row 1, y down column A, z in the cells)
+// with the selected method and depth, and saves the dense matrix in the same layout
+void HomeWindow::onInterpolateGridClicked()
+{
+    QString inputName = QFileDialog::getOpenFileName(this, "Open Grid XLSX", "", "Excel Files (*.xlsx)");
+    if (inputName.isEmpty())
+        return;
+
+    Document input(inputName);
+    if (!input.load()) {
+        QMessageBox::warning(this, "Error", "Failed to open XLSX file.");
+
+        return;
+    }
+
+    // Read the axes until their first empty cell, then the matrix they span
+    std::vector<double> grid_x, grid_y, grid_z;
+    bool ok = true;
+    for (int column = 2; ok && !input.read(1, column).toString().isEmpty(); ++column)
+        grid_x.push_back(input.read(1, column).toString().toDouble(&ok));
+    for (int row = 2; ok && !input.read(row, 1).toString().isEmpty(); ++row)
+        grid_y.push_back(input.read(row, 1).toString().toDouble(&ok));
+    for (size_t row = 0; ok && row < grid_y.size(); ++row)
+        for (size_t column = 0; ok && column < grid_x.size(); ++column)
+            grid_z.push_back(input.read(row + 2, column + 2).toString().toDouble(&ok));
+
+    if (!ok || grid_x.size() < 2 || grid_y.size() < 2) {
+        QMessageBox::warning(this, "Invalid Input", "The grid needs at least two numeric X values in row 1, two numeric Y values in column A and a number in every cell between them.");
+
+        return;
+    }
+
+    try {
+        Interpolator interp = selectedInterpolator();
+        Interpolator::SurfaceData surface = interp.computeInterpolatedSurface(grid_x, grid_y, grid_z, ui->depthSlider->value());
+
+        QString fileName = QFileDialog::getSaveFileName(this, "Save Grid XLSX", "surface.xlsx", "Excel Files (*.xlsx)");
+        if (fileName.isEmpty())
+            return;
+
+        Document xlsx;
+        size_t columns = surface.dense_x.size();
+        for (size_t column = 0; column < columns; ++column)
+            xlsx.write(1, column + 2, surface.dense_x[column]);
+        for (size_t row = 0; row < surface.dense_y.size(); ++row) {
+            xlsx.write(row + 2, 1, surface.dense_y[row]);
+            for (size_t column = 0; column < columns; ++column)
+                xlsx.write(row + 2, column + 2, surface.dense_z[row * columns + column]);
+        }
+
+        if (!xlsx.saveAs(fileName)) {
+            QMessageBox::warning(this, "Error", "Failed to save XLSX file.");
+
+            return;
+        }
+
+        QMessageBox::information(this, "Export", QString("Interpolated %1 x %2 grid exported to XLSX successfully.")
+                                                     .arg(surface.dense_y.size())
+                                                     .arg(columns));
+    } catch (const std::exception &ex) {
+        QMessageBox::warning(this, "Interpolation Error", ex.what());
+    }
+}
+
+// Slot: Re-evaluates the curve for the visible x-range at about one sample per pixel column,
+// so deep zooms stay sharp without ever precomputing the full-resolution grid
+void HomeWindow::onViewportChanged(qreal min,
+                                   qreal max)
+{
+    if (!lastInterpolant || !curve || lastNodes.empty() || !(max > min))
+        return;
+
+    // Only the part of the view covered by the data is drawn
+    double lower = std::max<double>(min, lastNodes.front());
+    double upper = std::min<double>(max, lastNodes.back());
+    if (!(upper > lower)) {
+        curve->clear();
+
+        return;
+    }
+
+    double columns = std::max(2.0, ui->chartView->chart()->plotArea().width());
+    size_t count = static_cast<size_t>(std::ceil(columns * (upper - lower) / (max - min))) + 1;
+    count = std::max<size_t>(count, 2);
+
+    std::vector<double> x(count), y(count);
+    for (size_t i = 0; i < count; ++i)
+        x[i] = lower + (upper - lower) * i / (count - 1);
+    lastInterpolant->evaluate(x.data(), y.data(), count);
+
+    QList<QPointF> points;
+    points.reserve(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; ++i)
+        points.append(QPointF(x[i], y[i]));
+    curve->replace(points);
+
+    if (lastSeries && !extraCurves.isEmpty()) {
+        std::vector<std::vector<double>> extraY;
+        lastSeries->evaluate(x.data(), count, extraY);
+        for (qsizetype s = 0; s < extraCurves.size(); ++s) {
+            for (size_t i = 0; i < count; ++i)
+                points[i].setY(extraY[s][i]);
+            extraCurves[s]->replace(points);
+        }
+    }
+}
+
+// Slot: Debounced live recompute, a full one after table edits and only a new grid after depth changes
+void HomeWindow::onRecomputeTimeout()
+{
+    if (!lastInterpolant)
+        return;
+
+    if (tableEdited)
+        interpolateTable(false);
+    else
+        refreshDepth();
+}
+
+// Slot: Starts following a CSV file of x, y rows, or stops following it
+void HomeWindow::onWatchToggled(bool checked)
+{
+    if (!watchedPath.isEmpty())
+        watcher.removePath(watchedPath);
+    watchedPath.clear();
+
+    if (!checked) {
+        statusBar()->showMessage("Stopped watching");
+
+        return;
+    }
+
+    QString fileName = QFileDialog::getOpenFileName(this, "Watch CSV File", "", "CSV Files (*.csv *.txt *.log);;All Files (*)");
+    if (fileName.isEmpty() || !watcher.addPath(fileName)) {
+        QSignalBlocker blocker(ui->watchButton);
+        ui->watchButton->setChecked(false);
+
+        return;
+    }
+
+    // The chart now belongs to the feed: nothing from the table should redraw or export over it
+    watchedPath = fileName;
+    watchedOffset = 0;
+    watchedPartial.clear();
+    stream.clear();
+    lastInterpolant.reset();
+    lastData.reset();
+    lastSeries.reset();
+    lastNodes.clear();
+    ui->chartView->chart()->removeAllSeries();
+    curve = nullptr;
+    extraCurves.clear();
+    ui->saveXLSXButton->setEnabled(false);
+
+    onWatchedFileChanged(watchedPath);
+    statusBar()->showMessage(QString("Watching %1").arg(watchedPath));
+}
+
+// Slot: Reads the lines appended to the watched file since the last call and extends the curve
+// through the sliding-window interpolant, one segment per new point at the current depth
+void HomeWindow::onWatchedFileChanged(const QString &path)
+{
+    if (path != watchedPath)
+        return;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    // Editors that save by writing a new file drop it from the watcher
+    if (!watcher.files().contains(path))
+        watcher.addPath(path);
+
+    // A shorter file was truncated or replaced, so start over from its beginning
+    if (file.size() < watchedOffset) {
+        watchedOffset = 0;
+        watchedPartial.clear();
+        stream.clear();
+        ui->chartView->chart()->removeAllSeries();
+        curve = nullptr;
+        extraCurves.clear();
+    }
+
+    file.seek(watchedOffset);
+    QByteArray appended = file.readAll();
+    watchedOffset += appended.size();
+    watchedPartial += appended;
+
+    qsizetype end = watchedPartial.lastIndexOf('\n');
+    if (end < 0)
+        return;
+    QList<QByteArray> lines = watchedPartial.left(end).split('\n');
+    watchedPartial.remove(0, end + 1);
+
+    static const QRegularExpression separators("[,;\\s]+");
+    int segments = ui->depthSlider->value() + 1;
+    std::vector<double> x(segments), y(segments);
+    QList<QPointF> points;
+    for (const QByteArray &line : lines) {
+        QStringList fields = QString::fromUtf8(line).split(separators, Qt::SkipEmptyParts);
+        if (fields.size() < 2)
+            continue;
+
+        bool okX = false, okY = false;
+        double px = fields[0].toDouble(&okX);
+        double py = fields[1].toDouble(&okY);
+        if (!okX || !okY)
+            continue;           // Header or malformed line
+
+        double previous = stream.newest();
+        if (!stream.append(px, py))
+            continue;
+
+        if (std::isnan(previous)) {
+            points.append(QPointF(px, py));
+        } else if (px > previous) {
+            // Only the new stretch is drawn; what is already on the chart stays as it was
+            std::shared_ptr<const BarycentricInterpolant> model = stream.snapshot();
+            for (int j = 0; j < segments; ++j)
+                x[j] = previous + (px - previous) * (j + 1) / segments;
+            model->evaluate(x.data(), y.data(), segments);
+            y[segments - 1] = py;
+            for (int j = 0; j < segments; ++j)
+                points.append(QPointF(x[j], y[j]));
+        }
+    }
+
+    appendToCurve(points);
+}
+
+//                      EVENTS                       //
+
+// Chart interaction: the wheel zooms around the cursor, left drag pans, double click restores the full view
+bool HomeWindow::eventFilter(QObject *watched,
+                             QEvent *event)
+{
+    if (watched != ui->chartView->viewport() || !curve)
+        return QMainWindow::eventFilter(watched, event);
+
+    QChart *chart = ui->chartView->chart();
+    switch (event->type()) {
+    case QEvent::Wheel: {
+        auto wheel = static_cast<QWheelEvent *>(event);
+        double factor = wheel->angleDelta().y() > 0 ? 1.25 : 0.8;            // Zoom in on wheel up
+
+        // Scale the plot area around the cursor so the point under it stays put
+        QRectF area = chart->plotArea();
+        QPointF anchor = chart->mapFromScene(ui->chartView->mapToScene(wheel->position().toPoint()));
+        QRectF zoomed(anchor.x() - (anchor.x() - area.left()) / factor,
+                      anchor.y() - (anchor.y() - area.top()) / factor,
+                      area.width() / factor,
+                      area.height() / factor);
+        chart->zoomIn(zoomed);
+
+        return true;
+    }
+    case QEvent::MouseButtonPress: {
+        auto mouse = static_cast<QMouseEvent *>(event);
+        if (mouse->button() != Qt::LeftButton)
+            break;
+
+        panning = true;
+        panOrigin = mouse->position();
+
+        return true;
+    }
+    case QEvent::MouseMove: {
+        if (!panning)
+            break;
+
+        auto mouse = static_cast<QMouseEvent *>(event);
+        QPointF delta = mouse->position() - panOrigin;
+        panOrigin = mouse->position();
+        chart->scroll(-delta.x(), delta.y());
+
+        return true;
+    }
+    case QEvent::MouseButtonRelease:
+        panning = false;
+        break;
+    case QEvent::MouseButtonDblClick:
+        chart->zoomReset();
+
+        return true;
+    default:
+        break;
+    }
+
+    return QMainWindow::eventFilter(watched, event);
+}
+
 //                      FUNCTIONS                       //
 
-// Fetch X values from the table
-std::vector<double> HomeWindow::getXValues()
+// Interpolator configured with the method and parameter chosen in the UI
+Interpolator HomeWindow::selectedInterpolator() const
+{
+    Interpolator interp;
+    interp.setMethod(static_cast<Interpolator::Method>(ui->methodComboBox->currentData().toInt()));
+    if (interp.method() == Interpolator::Method::FloaterHormann)
+        interp.setBlendingDegree(ui->parameterSpinBox->value());
+    if (interp.method() == Interpolator::Method::LeastSquares)
+        interp.setFitDegree(ui->parameterSpinBox->value());
+
+    return interp;
+}
+
+// Parses the table in one pass: column 0 holds x, column 1 the main y and later columns extra series,
+// which take part only when every row fills them. Empty rows are skipped; the result is validated by Dataset,
+// which throws std::invalid_argument, as does a row with only one of x and y.
+Dataset HomeWindow::readTable(bool allowDuplicates) const
 {
     int rows = ui->inputTable->rowCount();
+    int columns = std::max(ui->inputTable->columnCount(), 2);
+
+    auto parse = [&](int row, int column, bool &ok) {
+        QTableWidgetItem *item = ui->inputTable->item(row, column);
+        ok = false;
+
+        return item ? item->text().trimmed().toDouble(&ok) : 0.0;
+    };
 
     std::vector<double> x;
-    for (int i = 0; i < rows; ++i) {
-        auto item = ui->inputTable->item(i, 0);
-        if (item && !item->text().isEmpty()) {
-            bool ok;
-            double val = item->text().toDouble(&ok);
-            if (ok)
-                x.push_back(val);
+    std::vector<std::vector<double>> y(columns - 1);
+    std::vector<bool> complete(y.size(), true);
+    x.reserve(rows);
+    for (std::vector<double> &column : y)
+        column.reserve(rows);
+
+    for (int row = 0; row < rows; ++row) {
+        bool hasX = false, hasY = false;
+        double px = parse(row, 0, hasX);
+        double py = parse(row, 1, hasY);
+        if (!hasX && !hasY)
+            continue;
+        if (!hasX || !hasY)
+            throw std::invalid_argument(QString("Row %1 needs both an X and a Y value").arg(row + 1).toStdString());
+
+        x.push_back(px);
+        y[0].push_back(py);
+        for (int column = 2; column < columns; ++column) {
+            bool ok = false;
+            double value = parse(row, column, ok);
+            y[column - 1].push_back(value);
+            complete[column - 1] = complete[column - 1] && ok;
         }
     }
 
-    return x;
+    std::vector<std::vector<double>> filled;
+    for (size_t series = 0; series < y.size(); ++series)
+        if (series == 0 || (complete[series] && !x.empty()))
+            filled.push_back(std::move(y[series]));
+
+    return Dataset(std::move(x), std::move(filled), allowDuplicates);
 }
 
-// Fetch Y values from the table
-std::vector<double> HomeWindow::getYValues()
+// Writes the plotted curve as CSV rows of x, y and any extra series. Rows come from the cached samples or the
+// generator a chunk at a time and go straight to disk, so memory stays bounded by the chunk size.
+bool HomeWindow::saveCsv(const QString &fileName)
 {
-    int rows = ui->inputTable->rowCount();
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+        return false;
+
+    QTextStream out(&file);
+    out.setRealNumberPrecision(17);
+
+    size_t extraCount = lastSeries ? lastSeries->seriesCount() : 0;
+    std::vector<std::vector<double>> extraY;
+    auto writeRows = [&](const double *x, const double *y, size_t count) {
+        if (extraCount > 0)
+            lastSeries->evaluate(x, count, extraY);
+        for (size_t i = 0; i < count; ++i) {
+            out << x[i] << ',' << y[i];
+            for (size_t s = 0; s < extraCount; ++s)
+                out << ',' << extraY[s][i];
+            out << '\n';
+        }
+    };
+
+    if (lastData) {
+        size_t total = lastData->dense_x.size();
+        for (size_t first = 0; first < total; first += GridGenerator::DefaultChunkSize) {
+            size_t count = std::min<size_t>(GridGenerator::DefaultChunkSize, total - first);
+            writeRows(lastData->dense_x.data() + first, lastData->dense_y.data() + first, count);
+        }
+    } else {
+        GridGenerator grid(lastInterpolant, lastNodes, lastDepth);
+        GridGenerator::Chunk chunk;
+        while (grid.next(chunk))
+            writeRows(chunk.x.data(), chunk.y.data(), chunk.x.size());
+    }
+
+    out.flush();
+
+    return out.status() == QTextStream::Ok && file.error() == QFileDevice::NoError;
+}
+
+// Plot a grid too large to hold in memory, pulling it from the generator chunk by chunk over [lower, upper].
+// Each pixel column keeps only its first, lowest, highest and last sample, which draws the same line as the
+// full grid while memory stays proportional to the chart width; zooming in re-samples the visible range.
+void HomeWindow::plotGraph(GridGenerator &grid,
+                           double lower,
+                           double upper)
+{
+    struct Column
+    {
+        size_t index[4];            // Grid indices of the first, lowest, highest and last sample
+        QPointF point[4];
+        bool used = false;
+    };
+
+    size_t columns = static_cast<size_t>(std::max(ui->chartView->width(), MinPlotColumns));
+    double scale = upper > lower ? columns / (upper - lower) : 0.0;
+    std::vector<Column> buckets(columns);
+
+    GridGenerator::Chunk chunk;
+    while (grid.next(chunk)) {
+        for (size_t i = 0; i < chunk.x.size(); ++i) {
+            size_t index = chunk.offset + i;
+            QPointF point(chunk.x[i], chunk.y[i]);
+            double position = std::clamp((chunk.x[i] - lower) * scale, 0.0, static_cast<double>(columns - 1));
+            Column &column = buckets[static_cast<size_t>(position)];
+
+            if (!column.used) {
+                for (int k = 0; k < 4; ++k) {
+                    column.index[k] = index;
+                    column.point[k] = point;
+                }
+                column.used = true;
+
+                continue;
+            }
+            if (point.y() < column.point[1].y()) {
+                column.index[1] = index;
+                column.point[1] = point;
+            }
+            if (point.y() > column.point[2].y()) {
+                column.index[2] = index;
+                column.point[2] = point;
+            }
+            column.index[3] = index;
+            column.point[3] = point;
+        }
+    }
 
-    std::vector<double> y;
-    for (int i = 0; i < rows; ++i) {
-        auto item = ui->inputTable->item(i, 1);
-        if (item && !item->text().isEmpty()) {
-            bool ok;
-            double val = item->text().toDouble(&ok);
-            if (ok)
-                y.push_back(val);
+    // Emit each column's samples in grid order, once each
+    QList<QPointF> points;
+    points.reserve(static_cast<qsizetype>(4 * columns));
+    for (Column &column : buckets) {
+        if (!column.used)
+            continue;
+
+        if (column.index[1] > column.index[2]) {
+            std::swap(column.index[1], column.index[2]);
+            std::swap(column.point[1], column.point[2]);
         }
+        for (int k = 0; k < 4; ++k)
+            if (k == 0 || column.index[k] != column.index[k - 1])
+                points.append(column.point[k]);
     }
 
-    return y;
+    plotPoints(points);
 }
 
-// Plot the interpolated graph
-void HomeWindow::plotGraph(const std::vector<double> &x_points,
-                           const std::vector<double> &y_points)
+// Plot already computed samples, e.g. from the adaptive sampler
+void HomeWindow::plotGraph(const Interpolator::InterpolatedData &data)
 {
-    lastDenseX = x_points;
-    lastDenseY = y_points;
+    QList<QPointF> points;
+    points.reserve(static_cast<qsizetype>(data.dense_x.size()));
+    for (size_t i = 0; i < data.dense_x.size(); ++i)
+        points.append(QPointF(data.dense_x[i], data.dense_y[i]));
+
+    plotPoints(points);
+}
 
+// Replace the chart with a single series through the given points and fit the axes to them
+void HomeWindow::plotPoints(const QList<QPointF> &points)
+{
     ui->chartView->chart()->removeAllSeries();
+    curve = nullptr;
+    extraCurves.clear();
+
+    double minX = std::numeric_limits<double>::infinity();
+    double maxX = -minX;
+    double minY = minX;
+    double maxY = -minX;
+    for (const QPointF &point : points) {
+        minX = std::min(minX, point.x());
+        maxX = std::max(maxX, point.x());
+        minY = std::min(minY, point.y());
+        maxY = std::max(maxY, point.y());
+    }
 
     QLineSeries *series = new QLineSeries();
-    for (size_t i = 0; i < x_points.size(); ++i)
-        series->append(x_points[i], y_points[i]);
+    series->replace(points);
+    curve = series;
 
     // Create and populate the series
     QChart *chart = new QChart();
@@ -284,11 +956,6 @@ void HomeWindow::plotGraph(const std::vector<double> &x_points,
     QValueAxis *axisX = new QValueAxis;
     QValueAxis *axisY = new QValueAxis;
 
-    double minX = *std::min_element(x_points.begin(), x_points.end());
-    double maxX = *std::max_element(x_points.begin(), x_points.end());
-    double minY = *std::min_element(y_points.begin(), y_points.end());
-    double maxY = *std::max_element(y_points.begin(), y_points.end());
-
     // Calculate padding for axes
     int maxXTicks = 10;
     int maxYTicks = 5;
@@ -320,55 +987,301 @@ void HomeWindow::plotGraph(const std::vector<double> &x_points,
     series->attachAxis(axisX);
     series->attachAxis(axisY);
 
+    // Any later zoom or pan re-samples the visible range
+    connect(axisX, &QValueAxis::rangeChanged, this, &HomeWindow::onViewportChanged);
+
     ui->chartView->setChart(chart);
     ui->chartView->repaint();
 }
 
-// Check for statistical outliers using IQR (Interquartile Range),
-// which grabs specific data points and compares their upper and lower bounds to other data points
-void HomeWindow::checkForOutliers(const std::vector<double> &x_points,
-                                  const std::vector<double> &y_points)
+// Appends samples to the end of the current curve without rebuilding it, widening the axes when they run past them
+void HomeWindow::appendToCurve(const QList<QPointF> &points)
 {
-    if (x_points.size() < 3 || y_points.size() < 3)
+    if (points.isEmpty())
         return;
 
-    // IQR formula function
-    auto computeIQR = [](const std::vector<double> &data, double &lower, double &upper) {
-        std::vector<double> sorted = data;
-        std::sort(sorted.begin(), sorted.end());
+    if (!curve) {
+        plotPoints(points);
+        ui->saveGraphButton->setEnabled(true);
 
-        int n = sorted.size();
-        double q1 = sorted[n / 4];
-        double q3 = sorted[3 * n / 4];
-        double iqr = q3 - q1;
+        return;
+    }
 
-        lower = q1 - 1.5 * iqr;
-        upper = q3 + 1.5 * iqr;
-    };
+    curve->append(points);
+    if (curve->count() > MaxWatchedSamples)
+        curve->removePoints(0, curve->count() - MaxWatchedSamples);
 
-    // Searching for statistical outliers
-    double x_lower, x_upper, y_lower, y_upper;
+    QChart *chart = ui->chartView->chart();
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(chart->axes(Qt::Horizontal).value(0));
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(chart->axes(Qt::Vertical).value(0));
+    if (!axisX || !axisY)
+        return;
 
-    computeIQR(x_points, x_lower, x_upper);
-    computeIQR(y_points, y_lower, y_upper);
+    for (const QPointF &point : points) {
+        if (point.x() > axisX->max())
+            axisX->setMax(point.x() + 0.05 * (axisX->max() - axisX->min()));
+        if (point.y() > axisY->max())
+            axisY->setMax(point.y() + 0.05 * (axisY->max() - axisY->min()));
+        if (point.y() < axisY->min())
+            axisY->setMin(point.y() - 0.05 * (axisY->max() - axisY->min()));
+    }
+}
 
-    QStringList outlierList;
-    for (size_t i = 0; i < x_points.size(); ++i) {
-        bool x_out = x_points[i] < x_lower || x_points[i] > x_upper;
-        bool y_out = y_points[i] < y_lower || y_points[i] > y_upper;
+// Restarts the debounce timer, provided there is a table plot to keep current
+void HomeWindow::scheduleRecompute(bool tableChanged)
+{
+    if (!lastInterpolant)
+        return;
+
+    tableEdited = tableEdited || tableChanged;
+    recomputeTimer.start();
+}
+
+// Re-plots the current interpolant at the slider's depth. Samples of an earlier grid are reused when one grid
+// contains the other (e.g. depth d to 2d + 1), so a drag mostly evaluates only the points it has not seen yet.
+void HomeWindow::refreshDepth()
+{
+    int depth = ui->depthSlider->value();
+    if (depth == lastDepth)
+        return;
 
-        if (x_out || y_out) {
-            outlierList.append(QString("Row %1: X=%2, Y=%3").arg(i + 1).arg(QString::number(x_points[i], 'f', 5)).arg(QString::number(y_points[i], 'f', 5)));
+    // Adaptive samples depend on the depth only through their seed grid
+    if (lastAdaptive) {
+        int seed = AdaptiveSampler::seedDepth(depth);
+        bool unchanged = seed == AdaptiveSampler::seedDepth(lastDepth);
+        lastDepth = depth;
+        if (unchanged)
+            return;
+
+        lastDataKey.depth = ResultCache::AdaptiveDepth - seed;
+        lastData = resultCache.data(lastDataKey);
+        if (!lastData) {
+            lastData = std::make_shared<const Interpolator::InterpolatedData>(AdaptiveSampler().sample(*lastInterpolant, lastNodes, depth));
+            resultCache.insert(lastDataKey, lastData);
         }
+        plotGraph(*lastData);
+        plotExtraSeries();
+
+        return;
     }
 
-    // Warn the user only once for each unique dataset
-    if (!outlierList.isEmpty() && (x_points != lastDenseX || y_points != lastDenseY)
-        && (x_points != lastWarningX || y_points != lastWarningY)) {
-        QMessageBox::warning(this, "Possible Outliers Detected",
-                             QString("The following point(s) may be statistical outliers:\n\n%1\n\nInterpolation may be unstable.").arg(outlierList.join("\n")));
+    std::shared_ptr<const Interpolator::InterpolatedData> previous = lastData;
+    int previousDepth = lastDepth;
+    lastDepth = depth;
+    lastDataKey.depth = depth;
+    lastData.reset();
 
-        lastWarningX = x_points;
-        lastWarningY = y_points;
+    size_t gridBytes = 2 * sizeof(double) * GridGenerator::gridSize(lastNodes.size(), depth);
+    if (gridBytes > resultCache.capacity()) {
+        GridGenerator grid(lastInterpolant, lastNodes, lastDepth);
+        plotGraph(grid, lastNodes.front(), lastNodes.back());
+        plotExtraSeries();
+
+        return;
     }
+
+    lastData = resultCache.data(lastDataKey);
+    if (!lastData) {
+        // A grid on screen that contains the new one needs no evaluation at all; otherwise look for the
+        // finest cached grid nested in the new one, finer than the one on screen
+        int segments = depth + 1;
+        int previousSegments = previousDepth + 1;
+        bool contains = previous && previousSegments % segments == 0;
+        int nestedFloor = previous && segments % previousSegments == 0 ? previousSegments : 0;
+        for (int candidate = segments / 2; !contains && candidate > nestedFloor; --candidate) {
+            if (segments % candidate != 0)
+                continue;
+
+            ResultCache::Key nestedKey = {lastDataKey.fingerprint, lastDataKey.method, candidate - 1};
+            if (std::shared_ptr<const Interpolator::InterpolatedData> nested = resultCache.data(nestedKey)) {
+                previous = nested;
+                previousDepth = candidate - 1;
+                break;
+            }
+        }
+
+        // While the slider is held, steps fill whichever drag buffer is not on screen and stay out of the cache,
+        // so once both buffers have grown to the grid size a step allocates no samples; a settled depth is cached
+        std::shared_ptr<Interpolator::InterpolatedData> data;
+        if (ui->depthSlider->isSliderDown()) {
+            for (std::shared_ptr<Interpolator::InterpolatedData> &buffer : dragBuffers) {
+                if (!buffer)
+                    buffer = std::make_shared<Interpolator::InterpolatedData>();
+                if (buffer.use_count() == 1) {
+                    data = buffer;
+                    break;
+                }
+            }
+        }
+        bool cached = !data;
+        if (cached)
+            data = std::make_shared<Interpolator::InterpolatedData>();
+
+        if (previous)
+            Interpolator::refineOnGrid(*lastInterpolant, lastNodes, depth, *previous, previousDepth, *data, dragWorkspace);
+        else
+            Interpolator::evaluateOnGrid(*lastInterpolant, lastNodes, depth, *data);
+        lastData = data;
+        if (cached)
+            resultCache.insert(lastDataKey, lastData);
+    }
+    plotGraph(*lastData);
+    plotExtraSeries();
+}
+
+// Adds the extra series of lastSeries to the current chart, sampled at the main curve's x-values
+void HomeWindow::plotExtraSeries()
+{
+    if (!lastSeries || !curve)
+        return;
+
+    QList<QPointF> points = curve->points();
+    std::vector<double> x(points.size());
+    for (qsizetype i = 0; i < points.size(); ++i)
+        x[i] = points[i].x();
+
+    std::vector<std::vector<double>> extraY;
+    lastSeries->evaluate(x.data(), x.size(), extraY);
+
+    QChart *chart = ui->chartView->chart();
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(chart->axes(Qt::Vertical).value(0));
+    double minY = axisY ? axisY->min() : 0.0;
+    double maxY = axisY ? axisY->max() : 0.0;
+
+    curve->setName("Y");
+    for (size_t s = 0; s < extraY.size(); ++s) {
+        for (size_t i = 0; i < x.size(); ++i) {
+            points[i].setY(extraY[s][i]);
+            minY = std::min(minY, extraY[s][i]);
+            maxY = std::max(maxY, extraY[s][i]);
+        }
+
+        QLineSeries *series = new QLineSeries();
+        series->setName(QString("Y%1").arg(s + 2));
+        series->replace(points);
+        chart->addSeries(series);
+        for (QAbstractAxis *axis : chart->axes())
+            series->attachAxis(axis);
+        extraCurves.append(series);
+    }
+
+    // Widen the y-axis when an extra series leaves the main curve's range
+    if (axisY && (minY < axisY->min() || maxY > axisY->max()))
+        axisY->setRange(std::floor(minY), std::ceil(maxY));
+}
+
+// Sets the table to one X column and columns - 1 Y columns, headed Y, Y2, Y3, ...
+void HomeWindow::setSeriesColumns(int columns)
+{
+    columns = std::max(columns, 2);
+    ui->inputTable->setColumnCount(columns);
+
+    QStringList headers = {"X", "Y"};
+    for (int column = 2; column < columns; ++column)
+        headers.append(QString("Y%1").arg(column));
+    ui->inputTable->setHorizontalHeaderLabels(headers);
+}
+
+// Applies the current contents of a table row to the live model as an insert, remove or update
+void HomeWindow::syncRowPoint(int row)
+{
+    if (row < 0)
+        return;
+
+    const double none = std::numeric_limits<double>::quiet_NaN();
+    if (static_cast<int>(rowX.size()) <= row) {
+        rowX.resize(row + 1, none);
+        rowY.resize(row + 1, none);
+    }
+
+    // A row contributes a point only when both cells hold numbers
+    double x = none;
+    double y = none;
+    auto xItem = ui->inputTable->item(row, 0);
+    auto yItem = ui->inputTable->item(row, 1);
+    if (xItem && yItem) {
+        bool xOk = false;
+        bool yOk = false;
+        double xValue = xItem->text().trimmed().toDouble(&xOk);
+        double yValue = yItem->text().trimmed().toDouble(&yOk);
+        if (xOk && yOk) {
+            x = xValue;
+            y = yValue;
+        }
+    }
+
+    double oldX = rowX[row];
+    double oldY = rowY[row];
+    bool hadPoint = !std::isnan(oldX);
+    bool hasPoint = !std::isnan(x);
+    if ((!hadPoint && !hasPoint) || (hadPoint && hasPoint && oldX == x && oldY == y))
+        return;
+
+    rowX[row] = x;
+    rowY[row] = y;
+    if (!liveModelValid)
+        return;
+
+    bool applied = true;
+    if (hadPoint && hasPoint)
+        applied = liveModel.update(oldX, x, y);
+    else if (hadPoint)
+        applied = liveModel.remove(oldX);
+    else
+        applied = liveModel.insert(x, y);
+
+    // Deltas the model cannot represent (duplicate x) fall back to a full rebuild on the next interpolation
+    if (!applied)
+        liveModelValid = false;
+}
+
+// Rebuilds the live model from scratch out of the per-row points, after a delta could not be applied
+void HomeWindow::rebuildLiveModel()
+{
+    std::vector<double> x, y;
+    for (size_t row = 0; row < rowX.size(); ++row) {
+        if (!std::isnan(rowX[row])) {
+            x.push_back(rowX[row]);
+            y.push_back(rowY[row]);
+        }
+    }
+
+    liveModelValid = liveModel.assign(x, y);
+}
+
+// Empties the live model along with the per-row bookkeeping
+void HomeWindow::resetLiveModel()
+{
+    liveModel.clear();
+    liveModelValid = true;
+    rowX.clear();
+    rowY.clear();
+}
+
+// Check for statistical outliers with the rule picked in the UI (IQR fences or MAD z-score),
+// which compares every point against bounds derived from the bulk of the data
+void HomeWindow::checkForOutliers(const std::vector<double> &x_points,
+                                  const std::vector<double> &y_points)
+{
+    if (x_points.size() < 3 || y_points.size() < 3)
+        return;
+
+    // Searching for statistical outliers
+    std::vector<size_t> rows = outliers.find(x_points, y_points);
+    if (rows.empty())
+        return;
+
+    // Warn the user only once for each unique dataset; switching the rule counts as a new one
+    uint64_t fingerprint = ResultCache::fingerprint(x_points, y_points) ^ (static_cast<uint64_t>(outliers.rule()) + 1);
+    if (fingerprint == lastWarningFingerprint)
+        return;
+
+    QStringList outlierList;
+    for (size_t i : rows)
+        outlierList.append(QString("Row %1: X=%2, Y=%3").arg(i + 1).arg(QString::number(x_points[i], 'f', 5)).arg(QString::number(y_points[i], 'f', 5)));
+
+    QMessageBox::warning(this, "Possible Outliers Detected",
+                         QString("The following point(s) may be statistical outliers:\n\n%1\n\nInterpolation may be unstable.").arg(outlierList.join("\n")));
+
+    lastWarningFingerprint = fingerprint;
 }
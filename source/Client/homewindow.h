@@ -1,9 +1,24 @@
 #ifndef HOMEWINDOW_H
 #define HOMEWINDOW_H
 
+#include "dataset.h"
+#include "gridgenerator.h"
+#include "incrementalinterpolant.h"
+#include "interpolant.h"
+#include "interpolator.h"
+#include "outlierdetector.h"
 #include "qtablewidget.h"
+#include "resultcache.h"
+#include "streaminginterpolant.h"
 
+#include <QByteArray>
+#include <QFileSystemWatcher>
+#include <QList>
 #include <QMainWindow>
+#include <QPointF>
+#include <QTimer>
+#include <QtCharts/QLineSeries>
+#include <memory>
 #include <vector>
 
 namespace Ui {
@@ -18,6 +33,9 @@ public:
     HomeWindow(QWidget *parent = nullptr);
     ~HomeWindow();
 
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
     void onImportXLSXClicked();
     void on_inputTable_itemChanged(QTableWidgetItem *item);
@@ -25,21 +43,62 @@ private slots:
     void onInterpolateClicked();
     void onSaveGraphClicked();
     void onSaveXLSXClicked();
+    void onInterpolateGridClicked();
+    void onViewportChanged(qreal min, qreal max);
+    void onWatchToggled(bool checked);
+    void onWatchedFileChanged(const QString &path);
+    void onRecomputeTimeout();
 
 private:
     Ui::HomeWindow *ui;
 
     std::vector<double> x_points;
     std::vector<double> y_points;
-    std::vector<double> lastDenseX = {0};
-    std::vector<double> lastDenseY = {0};
-    std::vector<double> lastWarningX = {1};
-    std::vector<double> lastWarningY = {1};
-
-    std::vector<double> getXValues();
-    std::vector<double> getYValues();
-    void plotGraph(const std::vector<double> &x_points, const std::vector<double> &y_points);
+    uint64_t lastWarningFingerprint = 0;            // Dataset and rule the last outlier warning was shown for
+    OutlierDetector outliers;
+    std::shared_ptr<const Interpolant> lastInterpolant;         // Interpolant behind the current plot
+    std::vector<double> lastNodes;          // Sorted x-values the current plot's grid is derived from
+    int lastDepth = 0;
+    bool lastAdaptive = false;          // Current plot came from the adaptive sampler rather than the depth grid
+    std::shared_ptr<const Interpolator::InterpolatedData> lastData;         // Samples behind the current plot, null when streamed
+    ResultCache resultCache;            // Interpolants and samples of recently plotted datasets
+    ResultCache::Key lastDataKey = {0, 0, 0};           // Cache key of the current plot's samples
+    std::shared_ptr<Interpolator::InterpolatedData> dragBuffers[2];          // Reused samples of uncached depths while the slider is held
+    Interpolator::Workspace dragWorkspace;          // Scratch of refineOnGrid, reused across depth changes
+    QTimer recomputeTimer;          // Debounces live recomputes while the slider is dragged or cells are edited
+    bool tableEdited = false;           // The pending recompute needs a new interpolant, not just a new grid
+    QLineSeries *curve = nullptr;           // Series showing lastInterpolant, refilled on zoom and pan
+    std::shared_ptr<const SeriesInterpolant> lastSeries;            // Extra Y columns of the current plot, null if none
+    QList<QLineSeries *> extraCurves;           // One series per lastSeries column, refilled along with curve
+    QPointF panOrigin;          // Last mouse position while dragging the chart
+    bool panning = false;
+
+    IncrementalInterpolant liveModel;           // Barycentric model kept in step with table edits
+    bool liveModelValid = true;         // False after an edit the model could not apply (e.g. duplicate x)
+    std::vector<double> rowX, rowY;         // Point each table row contributes to liveModel, NaN if none
+
+    QFileSystemWatcher watcher;         // Watch mode: notifies when the followed CSV grows
+    QString watchedPath;
+    qint64 watchedOffset = 0;           // Bytes of the file already consumed
+    QByteArray watchedPartial;          // Trailing line still waiting for its newline
+    StreamingInterpolant stream;            // Most recent points of the followed file
+
+    Interpolator selectedInterpolator() const;
+    Dataset readTable(bool allowDuplicates) const;
+    void interpolateTable(bool interactive);
+    bool saveCsv(const QString &fileName);
+    void plotGraph(GridGenerator &grid, double lower, double upper);
+    void plotGraph(const Interpolator::InterpolatedData &data);
+    void plotPoints(const QList<QPointF> &points);
+    void plotExtraSeries();
+    void scheduleRecompute(bool tableChanged);
+    void refreshDepth();
+    void appendToCurve(const QList<QPointF> &points);
+    void setSeriesColumns(int columns);
     void checkForOutliers(const std::vector<double> &x_points, const std::vector<double> &y_points);
+    void syncRowPoint(int row);
+    void rebuildLiveModel();
+    void resetLiveModel();
 };
 
 #endif //HOMEWINDOW_H
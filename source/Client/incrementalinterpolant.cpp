@@ -0,0 +1,189 @@
+#include "incrementalinterpolant.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+
+// Replaces the whole model with a fresh dataset, O(n²) once; returns false on duplicate x-values
+bool IncrementalInterpolant::assign(const std::vector<double> &x,
+                                    const std::vector<double> &y)
+{
+    clear();
+    if (x.size() != y.size())
+        return false;
+
+    // Order the points by x through an index permutation
+    std::vector<size_t> order(x.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return x[a] < x[b]; });
+
+    for (size_t i : order) {
+        if (!xi.empty() && xi.back() == x[i]) {
+            clear();
+
+            return false;
+        }
+        xi.push_back(x[i]);
+        yi.push_back(y[i]);
+    }
+
+    wi = BarycentricInterpolant::computeWeights(xi, &scaleExponent);
+
+    return true;
+}
+
+// Drops every point
+void IncrementalInterpolant::clear()
+{
+    xi.clear();
+    yi.clear();
+    wi.clear();
+    scaleExponent = 0;
+}
+
+// Adds a point in O(n): every existing weight gains a 1 / (x_i - x) factor; returns false if x is already present
+bool IncrementalInterpolant::insert(double x,
+                                    double y)
+{
+    if (!std::isfinite(x) || contains(x))
+        return false;
+
+    double largest = 0.0;
+    for (size_t i = 0; i < xi.size(); ++i) {
+        wi[i] /= xi[i] - x;
+        largest = std::max(largest, std::fabs(wi[i]));
+    }
+
+    // New weight 1 / prod(x - x_i), with its binary exponent tracked apart from the mantissa
+    double mantissa = 1.0;
+    int exponent = 0;
+    for (double node : xi) {
+        int shift = 0;
+        mantissa = std::frexp(mantissa * (x - node), &shift);
+        exponent += shift;
+    }
+
+    double weight = 1.0 / mantissa;
+    if (xi.empty()) {
+        scaleExponent = -exponent;
+    } else {
+        int shift = -exponent - scaleExponent;
+        if (shift > 256) {
+            // The new weight dwarfs the others: move the common scale up to it first
+            for (double &w : wi)
+                w = std::ldexp(w, -shift);
+            largest = std::ldexp(largest, -shift);
+            scaleExponent += shift;
+        } else {
+            weight = std::ldexp(weight, shift);
+        }
+    }
+    largest = std::max(largest, std::fabs(weight));
+
+    size_t pos = std::lower_bound(xi.begin(), xi.end(), x) - xi.begin();
+    xi.insert(xi.begin() + pos, x);
+    yi.insert(yi.begin() + pos, y);
+    wi.insert(wi.begin() + pos, weight);
+
+    normalize(largest);
+
+    return true;
+}
+
+// Removes a point in O(n): every remaining weight gets its (x_i - x) factor back; returns false if x is unknown
+bool IncrementalInterpolant::remove(double x)
+{
+    size_t pos = find(x);
+    if (pos == xi.size())
+        return false;
+
+    xi.erase(xi.begin() + pos);
+    yi.erase(yi.begin() + pos);
+    wi.erase(wi.begin() + pos);
+
+    double largest = 0.0;
+    for (size_t i = 0; i < xi.size(); ++i) {
+        wi[i] *= xi[i] - x;
+        largest = std::max(largest, std::fabs(wi[i]));
+    }
+
+    normalize(largest);
+
+    return true;
+}
+
+// Changes one point: a y-only edit is O(log n), moving it along x is a remove plus an insert
+bool IncrementalInterpolant::update(double oldX,
+                                    double x,
+                                    double y)
+{
+    size_t pos = find(oldX);
+    if (pos == xi.size())
+        return false;
+
+    if (oldX == x) {
+        yi[pos] = y;
+
+        return true;
+    }
+
+    if (contains(x))
+        return false;
+
+    remove(oldX);
+
+    return insert(x, y);
+}
+
+// Checks whether a node with this exact x exists
+bool IncrementalInterpolant::contains(double x) const
+{
+    return find(x) != xi.size();
+}
+
+size_t IncrementalInterpolant::size() const
+{
+    return xi.size();
+}
+
+const std::vector<double> &IncrementalInterpolant::nodes() const
+{
+    return xi;
+}
+
+// Copies the current state into an immutable interpolant, O(n)
+std::shared_ptr<const BarycentricInterpolant> IncrementalInterpolant::snapshot() const
+{
+    return std::make_shared<BarycentricInterpolant>(xi, yi, wi);
+}
+
+// True when the model's nodes and values are exactly the given sorted points, O(n)
+bool IncrementalInterpolant::matches(const std::vector<double> &sorted_x,
+                                     const std::vector<double> &sorted_y) const
+{
+    return xi == sorted_x && yi == sorted_y;
+}
+
+// Binary search for an exact node, returns size() when absent
+size_t IncrementalInterpolant::find(double x) const
+{
+    auto it = std::lower_bound(xi.begin(), xi.end(), x);
+    if (it == xi.end() || *it != x)
+        return xi.size();
+
+    return it - xi.begin();
+}
+
+// Pulls the weights back near 1 when repeated edits have drifted them towards overflow or underflow
+void IncrementalInterpolant::normalize(double largest)
+{
+    if (largest == 0.0 || (largest < 0x1p256 && largest > 0x1p-256))
+        return;
+
+    int exponent = 0;
+    std::frexp(largest, &exponent);
+    for (double &w : wi)
+        w = std::ldexp(w, -exponent);
+    scaleExponent += exponent;
+}
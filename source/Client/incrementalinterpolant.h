@@ -0,0 +1,36 @@
+#ifndef INCREMENTALINTERPOLANT_H
+#define INCREMENTALINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <memory>
+#include <vector>
+
+// Mutable barycentric model whose weights stay current under single-point edits.
+// Insert, remove and move cost O(n) instead of the O(n²) full weight rebuild;
+// snapshot() hands out an immutable BarycentricInterpolant for evaluation.
+class IncrementalInterpolant
+{
+public:
+    bool assign(const std::vector<double> &x, const std::vector<double> &y);
+    void clear();
+
+    bool insert(double x, double y);
+    bool remove(double x);
+    bool update(double oldX, double x, double y);
+    bool contains(double x) const;
+    bool matches(const std::vector<double> &sorted_x, const std::vector<double> &sorted_y) const;
+
+    size_t size() const;
+    const std::vector<double> &nodes() const;
+    std::shared_ptr<const BarycentricInterpolant> snapshot() const;
+
+private:
+    std::vector<double> xi, yi, wi;
+    int scaleExponent = 0;          // True weights are wi * 2^scaleExponent
+
+    size_t find(double x) const;
+    void normalize(double largest);
+};
+
+#endif //INCREMENTALINTERPOLANT_H
@@ -0,0 +1,438 @@
+#include "interpolant.h"
+#include "chebyshevinterpolant.h"
+#include "interpolator.h"
+#include "simdkernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+
+// Symmetric half of the 8-point Gauss-Legendre rule on [-1, 1]
+static const double GaussNodes[4] = {0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363};
+static const double GaussWeights[4] = {0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763};
+
+// Default batch evaluation, one scalar call per x
+void Interpolant::evaluate(const double *x,
+                           double *y,
+                           size_t count) const
+{
+    for (size_t i = 0; i < count; ++i)
+        y[i] = evaluate(x[i]);
+}
+
+// Numeric fallback for derivatives of order 1 or 2, central differences with steps balancing
+// truncation against rounding error; implementations with a closed form override it
+void Interpolant::derivative(const double *x,
+                             double *dy,
+                             size_t count,
+                             int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    const double epsilon = std::numeric_limits<double>::epsilon();
+    const double relativeStep = order == 1 ? std::cbrt(epsilon) : std::sqrt(std::sqrt(epsilon));
+    constexpr size_t Block = 256;
+    double step[Block], left[Block], right[Block], center[Block];
+
+    for (size_t start = 0; start < count; start += Block) {
+        size_t size = std::min(Block, count - start);
+        for (size_t i = 0; i < size; ++i) {
+            double h = relativeStep * std::max(1.0, std::fabs(x[start + i]));
+            left[i] = x[start + i] - h;
+            right[i] = x[start + i] + h;
+            step[i] = right[i] - left[i];           // The exactly representable 2h
+        }
+        evaluate(left, left, size);
+        evaluate(right, right, size);
+
+        if (order == 1) {
+            for (size_t i = 0; i < size; ++i)
+                dy[start + i] = (right[i] - left[i]) / step[i];
+        } else {
+            evaluate(x + start, center, size);
+            for (size_t i = 0; i < size; ++i)
+                dy[start + i] = 4.0 * (right[i] - 2.0 * center[i] + left[i]) / (step[i] * step[i]);
+        }
+    }
+}
+
+// Numeric fallback for the definite integral over [a, b] on 64 equal panels, exact for polynomials of degree 15
+// or less; piecewise interpolants, whose pieces do not line up with the panels, override it
+double Interpolant::integral(double a,
+                             double b) const
+{
+    return gaussLegendre(a, b, 64);
+}
+
+// 8-point Gauss-Legendre rule on equal panels of [a, b]
+double Interpolant::gaussLegendre(double a,
+                                  double b,
+                                  size_t panels) const
+{
+    constexpr size_t Block = 64;            // Panels evaluated per batch call
+
+    double x[Block * 8], y[Block * 8];
+    double half = 0.5 * (b - a) / panels;
+    double sum = 0.0;
+    for (size_t first = 0; first < panels; first += Block) {
+        size_t size = std::min(Block, panels - first);
+        for (size_t panel = 0; panel < size; ++panel) {
+            double middle = a + (2 * (first + panel) + 1) * half;
+            for (size_t k = 0; k < 4; ++k) {
+                x[panel * 8 + 2 * k] = middle - half * GaussNodes[k];
+                x[panel * 8 + 2 * k + 1] = middle + half * GaussNodes[k];
+            }
+        }
+        evaluate(x, y, size * 8);
+
+        for (size_t panel = 0; panel < size; ++panel)
+            for (size_t k = 0; k < 4; ++k)
+                sum += GaussWeights[k] * (y[panel * 8 + 2 * k] + y[panel * 8 + 2 * k + 1]);
+    }
+
+    return sum * half;
+}
+
+// 8-point Gauss-Legendre rule on the pieces between consecutive breaks, each cut into the same number of panels.
+// A piecewise polynomial of degree 15 or less per piece is integrated exactly when every break is a piece boundary.
+double Interpolant::gaussLegendre(const std::vector<double> &breaks,
+                                  size_t panels) const
+{
+    constexpr size_t Block = 64;            // Panels evaluated per batch call
+
+    double x[Block * 8], y[Block * 8], halves[Block];
+    size_t size = 0;
+    double sum = 0.0;
+    auto flush = [&]() {
+        evaluate(x, y, size * 8);
+        for (size_t panel = 0; panel < size; ++panel) {
+            double panelSum = 0.0;
+            for (size_t k = 0; k < 4; ++k)
+                panelSum += GaussWeights[k] * (y[panel * 8 + 2 * k] + y[panel * 8 + 2 * k + 1]);
+            sum += panelSum * halves[panel];
+        }
+        size = 0;
+    };
+
+    for (size_t piece = 0; piece + 1 < breaks.size(); ++piece) {
+        double half = 0.5 * (breaks[piece + 1] - breaks[piece]) / panels;
+        for (size_t p = 0; p < panels; ++p) {
+            double middle = breaks[piece] + (2 * p + 1) * half;
+            for (size_t k = 0; k < 4; ++k) {
+                x[size * 8 + 2 * k] = middle - half * GaussNodes[k];
+                x[size * 8 + 2 * k + 1] = middle + half * GaussNodes[k];
+            }
+            halves[size++] = half;
+            if (size == Block)
+                flush();
+        }
+    }
+    if (size > 0)
+        flush();
+
+    return sum;
+}
+
+// Tier the interpolant evaluates with, plain double unless an implementation says otherwise
+Interpolant::Precision Interpolant::precision() const
+{
+    return Precision::Double;
+}
+
+//                      LAGRANGE                       //
+
+LagrangeInterpolant::LagrangeInterpolant(std::vector<double> x,
+                                         std::vector<double> y)
+    : xi(std::move(x))
+    , yi(std::move(y))
+{}
+
+// Evaluates the classic Lagrange form at a given x
+double LagrangeInterpolant::evaluate(double x) const
+{
+    return Interpolator::evaluateLagrange(xi, yi, x);
+}
+
+// Same polynomial as the barycentric form, so its closed-form derivatives apply once the weights are derived, O(n²) per call
+void LagrangeInterpolant::derivative(const double *x,
+                                     double *dy,
+                                     size_t count,
+                                     int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    std::vector<double> wi = BarycentricInterpolant::computeWeights(xi);
+    Simd::evaluateBarycentricDerivatives(xi.data(), yi.data(), wi.data(), xi.size(), x,
+                                         order == 1 ? dy : nullptr, order == 2 ? dy : nullptr, count);
+}
+
+//                      BARYCENTRIC                       //
+
+BarycentricInterpolant::BarycentricInterpolant(std::vector<double> x,
+                                               std::vector<double> y)
+    : xi(std::move(x))
+    , yi(std::move(y))
+    , wi(computeWeights(xi))            // Weights depend only on the x-values, so derive them once per dataset
+{}
+
+// Wraps points with weights that were already derived elsewhere (e.g. kept up to date incrementally)
+BarycentricInterpolant::BarycentricInterpolant(std::vector<double> x,
+                                               std::vector<double> y,
+                                               std::vector<double> w)
+    : xi(std::move(x))
+    , yi(std::move(y))
+    , wi(std::move(w))
+{}
+
+// Evaluates the interpolating polynomial at a given x using the second (true) barycentric form
+double BarycentricInterpolant::evaluate(double x) const
+{
+    if (tier != Precision::Double) {
+        double y = 0.0;
+        evaluate(&x, &y, 1);
+
+        return y;
+    }
+
+    double numerator = 0.0;
+    double denominator = 0.0;
+
+    for (size_t i = 0; i < xi.size(); ++i) {
+        double diff = x - xi[i];
+        if (diff == 0.0)
+            return yi[i];           // Exactly on a node, the formula is undefined but the answer is known
+
+        double term = wi[i] / diff;
+        numerator += term * yi[i];
+        denominator += term;
+    }
+
+    return numerator / denominator;
+}
+
+// Evaluates the interpolant at count x-values with the best SIMD kernel available on this CPU
+void BarycentricInterpolant::evaluate(const double *x,
+                                      double *y,
+                                      size_t count) const
+{
+    if (tier == Precision::Single)
+        Simd::evaluateBarycentric(xf.data(), yf.data(), wf.data(), xf.size(), center, scale, x, y, count);
+    else if (tier == Precision::Compensated)
+        Simd::evaluateBarycentricCompensated(xi.data(), yi.data(), wi.data(), xi.size(), x, y, count);
+    else
+        Simd::evaluateBarycentric(xi.data(), yi.data(), wi.data(), xi.size(), x, y, count);
+}
+
+// Selects the evaluation tier; call before the interpolant is shared between threads
+void BarycentricInterpolant::setPrecision(Precision precision)
+{
+    tier = precision;
+    if (tier == Precision::Single) {
+        narrow(xi, yi, wi, xf, yf, wf, center, scale);
+    } else {
+        xf.clear();
+        yf.clear();
+        wf.clear();
+    }
+}
+
+// Float copies for the Single tier. The formula is invariant under an affine map of x and a common factor on the
+// weights, so the copies hold the nodes mapped onto [-1, 1] by (x - center) * scale and the weights relative to the
+// largest one; both stay well inside the float range however wide or clustered the data is
+void BarycentricInterpolant::narrow(const std::vector<double> &x,
+                                    const std::vector<double> &y,
+                                    const std::vector<double> &w,
+                                    std::vector<float> &xf,
+                                    std::vector<float> &yf,
+                                    std::vector<float> &wf,
+                                    double &center,
+                                    double &scale)
+{
+    double half = x.empty() ? 0.0 : 0.5 * (x.back() - x.front());
+    center = x.empty() ? 0.0 : 0.5 * (x.front() + x.back());
+    scale = half > 0.0 ? 1.0 / half : 1.0;
+
+    double largest = 0.0;
+    for (double weight : w)
+        largest = std::max(largest, std::fabs(weight));
+
+    xf.resize(x.size());
+    wf.resize(w.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        xf[i] = static_cast<float>((x[i] - center) * scale);
+        wf[i] = static_cast<float>(largest > 0.0 ? w[i] / largest : w[i]);
+    }
+    yf.assign(y.begin(), y.end());
+}
+
+Interpolant::Precision BarycentricInterpolant::precision() const
+{
+    return tier;
+}
+
+// Closed-form first or second derivative at count x-values, vectorized like the value kernel
+void BarycentricInterpolant::derivative(const double *x,
+                                        double *dy,
+                                        size_t count,
+                                        int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    Simd::evaluateBarycentricDerivatives(xi.data(), yi.data(), wi.data(), xi.size(), x,
+                                         order == 1 ? dy : nullptr, order == 2 ? dy : nullptr, count);
+}
+
+// Exact integral of the interpolating polynomial
+double BarycentricInterpolant::integral(double a,
+                                        double b) const
+{
+    return ChebyshevInterpolant::integratePolynomial(*this, xi.size(), a, b);
+}
+
+const std::vector<double> &BarycentricInterpolant::nodes() const
+{
+    return xi;
+}
+
+const std::vector<double> &BarycentricInterpolant::values() const
+{
+    return yi;
+}
+
+const std::vector<double> &BarycentricInterpolant::weights() const
+{
+    return wi;
+}
+
+// Computes the barycentric weights w_i = 1 / prod(x_i - x_j) for all j ≠ i.
+// The result is normalized to a largest weight of about 1; if scaleExponent is given,
+// it receives e such that the true weights are w_i * 2^e.
+std::vector<double> BarycentricInterpolant::computeWeights(const std::vector<double> &x,
+                                                           int *scaleExponent)
+{
+    std::vector<double> w(x.size(), 0.0);
+    std::vector<int> exponents(x.size(), 0);
+    int scale = computeWeights(x.data(), x.size(), w.data(), exponents.data());
+    if (scaleExponent)
+        *scaleExponent = scale;
+
+    return w;
+}
+
+// Allocation-free weight computation into caller-provided arrays (exponents is n ints of scratch).
+// Returns e such that the true weights are w_i * 2^e.
+int BarycentricInterpolant::computeWeights(const double *x,
+                                           size_t n,
+                                           double *w,
+                                           int *exponents)
+{
+    if (n == 0)
+        return 0;
+
+    // The raw products overflow or underflow quickly, so the binary exponent is tracked separately
+    int maxExponent = 0;
+    for (size_t i = 0; i < n; ++i) {
+        double mantissa = 1.0;
+        int exponent = 0;
+        for (size_t j = 0; j < n; ++j) {
+            if (j == i)
+                continue;
+
+            int shift = 0;
+            mantissa = std::frexp(mantissa * (x[i] - x[j]), &shift);
+            exponent += shift;
+        }
+
+        w[i] = 1.0 / mantissa;
+        exponents[i] = -exponent;
+        if (i == 0 || exponents[i] > maxExponent)
+            maxExponent = exponents[i];
+    }
+
+    // A common factor cancels out of the barycentric formula, so scale the weights relative to the largest one
+    for (size_t i = 0; i < n; ++i)
+        w[i] = std::ldexp(w[i], exponents[i] - maxExponent);
+
+    return maxExponent;
+}
+
+//                      FLOATER-HORMANN                       //
+
+FloaterHormannInterpolant::FloaterHormannInterpolant(std::vector<double> x,
+                                                     std::vector<double> y,
+                                                     size_t d)
+    : BarycentricInterpolant(x, std::move(y), computeWeights(x, d))
+    , d(x.empty() ? 0 : std::min(d, x.size() - 1))
+{}
+
+// The interpolant is rational, so the polynomial quadrature of the base class does not apply;
+// Gauss-Legendre with about one panel per node inside [a, b] resolves it instead
+double FloaterHormannInterpolant::integral(double a,
+                                           double b) const
+{
+    const std::vector<double> &x = nodes();
+    auto first = std::lower_bound(x.begin(), x.end(), std::min(a, b));
+    auto last = std::upper_bound(x.begin(), x.end(), std::max(a, b));
+    size_t panels = std::min<size_t>(std::max<ptrdiff_t>(last - first, 64), 4096);
+
+    return gaussLegendre(a, b, panels);
+}
+
+size_t FloaterHormannInterpolant::degree() const
+{
+    return d;
+}
+
+// Weights w_k = (-1)^(k-d) sum_{i in J_k} prod_{j=i..i+d, j != k} 1 / |x_k - x_j|, J_k = {i : k-d <= i <= k, 0 <= i < n-d}.
+// Consecutive products over J_k differ by one factor in and one out, so each weight costs O(d).
+// Distances are measured in units of the mean spacing to keep the products of d factors in range.
+std::vector<double> FloaterHormannInterpolant::computeWeights(const std::vector<double> &x,
+                                                              size_t d)
+{
+    size_t n = x.size();
+    std::vector<double> w(n, 0.0);
+    if (n == 0)
+        return w;
+    if (n == 1) {
+        w[0] = 1.0;
+
+        return w;
+    }
+
+    for (size_t k = 1; k < n; ++k)
+        if (x[k] == x[k - 1])
+            throw std::invalid_argument("Duplicate X value in interpolation input");
+
+    d = std::min(d, n - 1);
+    double spacing = (x.back() - x.front()) / (n - 1);
+    if (!(spacing > 0.0))
+        spacing = 1.0;
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t first = k >= d ? k - d : 0;
+        size_t last = std::min(k, n - 1 - d);
+
+        // Product for i = first, then slide the window right one node at a time
+        double product = 1.0;
+        for (size_t j = first; j <= first + d; ++j)
+            if (j != k)
+                product *= spacing / std::fabs(x[k] - x[j]);
+
+        double sum = product;
+        for (size_t i = first; i < last; ++i) {
+            product *= std::fabs(x[k] - x[i]) / spacing;
+            product *= spacing / std::fabs(x[k] - x[i + d + 1]);
+            sum += product;
+        }
+
+        w[k] = (k + d) % 2 == 0 ? sum : -sum;           // (-1)^(k-d)
+    }
+
+    return w;
+}
@@ -0,0 +1,101 @@
+#ifndef INTERPOLANT_H
+#define INTERPOLANT_H
+
+#include <cstddef>
+#include <vector>
+
+// Immutable interpolating function built once from points sorted by x.
+// All evaluation methods are const and touch no shared mutable state, so one instance can be used from many threads.
+class Interpolant
+{
+public:
+    // Arithmetic tier used for evaluation, cheapest first
+    enum class Precision
+    {
+        Single,         // float32 kernels, twice the SIMD lanes, about 1e-6 relative accuracy
+        Double,         // Plain double arithmetic
+        Compensated         // Double-double sums for ill-conditioned inputs, several times slower than Double
+    };
+
+    virtual ~Interpolant() = default;
+
+    virtual double evaluate(double x) const = 0;
+    virtual void evaluate(const double *x, double *y, size_t count) const;
+    virtual Precision precision() const;
+
+    virtual void derivative(const double *x, double *dy, size_t count, int order = 1) const;
+    virtual double integral(double a, double b) const;
+
+protected:
+    double gaussLegendre(double a, double b, size_t panels) const;
+    double gaussLegendre(const std::vector<double> &breaks, size_t panels) const;
+};
+
+// Classic Lagrange form, every evaluation recomputes all basis products
+class LagrangeInterpolant : public Interpolant
+{
+public:
+    LagrangeInterpolant(std::vector<double> x, std::vector<double> y);
+
+    double evaluate(double x) const override;
+    using Interpolant::evaluate;
+
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+
+private:
+    std::vector<double> xi, yi;
+};
+
+// Second-form barycentric Lagrange with weights derived once at construction
+class BarycentricInterpolant : public Interpolant
+{
+public:
+    BarycentricInterpolant(std::vector<double> x, std::vector<double> y);
+    BarycentricInterpolant(std::vector<double> x, std::vector<double> y, std::vector<double> w);
+
+    double evaluate(double x) const override;
+    void evaluate(const double *x, double *y, size_t count) const override;
+
+    void setPrecision(Precision tier);
+    Precision precision() const override;
+
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+    double integral(double a, double b) const override;
+
+    const std::vector<double> &nodes() const;
+    const std::vector<double> &values() const;
+    const std::vector<double> &weights() const;
+
+    static std::vector<double> computeWeights(const std::vector<double> &x, int *scaleExponent = nullptr);
+    static int computeWeights(const double *x, size_t n, double *w, int *exponents);
+    static void narrow(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &w,
+                       std::vector<float> &xf, std::vector<float> &yf, std::vector<float> &wf, double &center, double &scale);
+
+private:
+    std::vector<double> xi, yi, wi;
+    Precision tier = Precision::Double;
+    std::vector<float> xf, yf, wf;          // Narrowed copies for the Single tier
+    double center = 0.0;            // Map of the narrowed nodes onto [-1, 1], (x - center) * scale
+    double scale = 1.0;
+};
+
+// Floater-Hormann rational interpolation: a blend of the local polynomials through every d + 1 consecutive nodes.
+// It has no real poles and does not oscillate like the global polynomial on equispaced data,
+// the weights cost O(n d) and evaluation reuses the O(n) barycentric kernels.
+class FloaterHormannInterpolant : public BarycentricInterpolant
+{
+public:
+    static constexpr size_t DefaultDegree = 3;
+
+    FloaterHormannInterpolant(std::vector<double> x, std::vector<double> y, size_t d = DefaultDegree);
+
+    double integral(double a, double b) const override;
+    size_t degree() const;
+
+    static std::vector<double> computeWeights(const std::vector<double> &x, size_t d);
+
+private:
+    size_t d;
+};
+
+#endif //INTERPOLANT_H
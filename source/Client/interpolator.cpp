@@ -1,70 +1,574 @@
 #include "interpolator.h"
+#include "chebyshevinterpolant.h"
+#include "fft.h"
+#include "fixedlagrange.h"
+#include "gridgenerator.h"
+#include "localinterpolant.h"
+#include "newtoninterpolant.h"
+#include "parallelevaluator.h"
+#include "simdkernels.h"
+#include "splineinterpolant.h"
 
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <stdexcept>
+#include <utility>
 
 
-// Computes interpolated data using Lagrange polynomial interpolation
+// Largest Chebyshev series built from table data
+static const size_t MaxChebyshevNodes = size_t(1) << 16;
+
+// Computes interpolated data using the selected method
 Interpolator::InterpolatedData Interpolator::computeInterpolatedData(const std::vector<double> &x_points,
                                                                      const std::vector<double> &y_points,
-                                                                     int depth)
+                                                                     int depth) const
+{
+    // Ensure x and y data are of equal size
+    if (x_points.size() != y_points.size())
+        throw std::invalid_argument("Incomplete point input");
+    if (x_points.empty())
+        throw std::invalid_argument("No points to interpolate");
+
+    // Build the immutable interpolant once from the sorted input data
+    std::vector<double> sorted_x = x_points;
+    std::vector<double> sorted_y = y_points;
+    sortPoints(sorted_x, sorted_y);
+    std::shared_ptr<const Interpolant> interpolant = buildInterpolant(sorted_x, sorted_y);
+
+    return evaluateOnGrid(*interpolant, sorted_x, depth);
+}
+
+// First and second derivatives of the selected interpolant on the same dense grid as computeInterpolatedData
+Interpolator::DerivativeData Interpolator::computeDerivatives(const std::vector<double> &x_points,
+                                                              const std::vector<double> &y_points,
+                                                              int depth) const
+{
+    std::shared_ptr<const Interpolant> interpolant = createInterpolant(x_points, y_points);
+    std::vector<double> sorted_x = x_points;
+    std::sort(sorted_x.begin(), sorted_x.end());
+
+    return derivativesOnGrid(*interpolant, sorted_x, depth);
+}
+
+// Evaluates both derivatives of an existing interpolant on the dense grid derived from its sorted nodes
+Interpolator::DerivativeData Interpolator::derivativesOnGrid(const Interpolant &interpolant,
+                                                             const std::vector<double> &sorted_x,
+                                                             int depth)
+{
+    DerivativeData data;
+    data.dense_x = denseGrid(sorted_x, depth);
+    data.first.resize(data.dense_x.size());
+    data.second.resize(data.dense_x.size());
+    interpolant.derivative(data.dense_x.data(), data.first.data(), data.dense_x.size(), 1);
+    interpolant.derivative(data.dense_x.data(), data.second.data(), data.dense_x.size(), 2);
+
+    return data;
+}
+
+// Interpolates several y columns over the same x-values on the dense grid of computeInterpolatedData
+Interpolator::SeriesData Interpolator::computeInterpolatedSeries(const std::vector<double> &x_points,
+                                                                 const std::vector<std::vector<double>> &y_columns,
+                                                                 int depth) const
+{
+    std::shared_ptr<const SeriesInterpolant> series = createSeriesInterpolant(x_points, y_columns);
+    std::vector<double> sorted_x = x_points;
+    std::sort(sorted_x.begin(), sorted_x.end());
+
+    SeriesData data;
+    data.dense_x = denseGrid(sorted_x, depth);
+    series->evaluate(data.dense_x.data(), data.dense_x.size(), data.dense_y);
+
+    return data;
+}
+
+// Tensor-product interpolation of values on a rectilinear grid, z_values being row-major with one row per y.
+// The surface is separable, so every input row is interpolated along x as one series, then every resulting
+// column along y; the cost is about output size times (nx + ny) rather than times nx * ny.
+Interpolator::SurfaceData Interpolator::computeInterpolatedSurface(const std::vector<double> &x_points,
+                                                                   const std::vector<double> &y_points,
+                                                                   const std::vector<double> &z_values,
+                                                                   int depth) const
+{
+    size_t columns = x_points.size();
+    size_t rows = y_points.size();
+    if (columns == 0 || rows == 0)
+        throw std::invalid_argument("No points to interpolate");
+    if (z_values.size() != columns * rows)
+        throw std::invalid_argument("Incomplete grid input");
+
+    // Along x: each input row is one series over the shared x-values
+    std::vector<std::vector<double>> inputRows(rows);
+    for (size_t r = 0; r < rows; ++r)
+        inputRows[r].assign(z_values.begin() + r * columns, z_values.begin() + (r + 1) * columns);
+    SeriesData alongX = computeInterpolatedSeries(x_points, inputRows, depth);
+    inputRows.clear();
+
+    // Along y: each dense column is one series over the shared y-values
+    size_t denseColumns = alongX.dense_x.size();
+    std::vector<std::vector<double>> denseColumnsY(denseColumns, std::vector<double>(rows));
+    for (size_t r = 0; r < rows; ++r)
+        for (size_t c = 0; c < denseColumns; ++c)
+            denseColumnsY[c][r] = alongX.dense_y[r][c];
+    alongX.dense_y.clear();
+    SeriesData alongY = computeInterpolatedSeries(y_points, denseColumnsY, depth);
+
+    SurfaceData surface;
+    surface.dense_x = std::move(alongX.dense_x);
+    surface.dense_y = std::move(alongY.dense_x);
+    surface.dense_z.resize(surface.dense_y.size() * denseColumns);
+    for (size_t c = 0; c < denseColumns; ++c)
+        for (size_t r = 0; r < surface.dense_y.size(); ++r)
+            surface.dense_z[r * denseColumns + c] = alongY.dense_y[c][r];
+
+    return surface;
+}
+
+// Sorts x once and builds one model for all columns: the shared Lagrange basis for the global polynomial
+// (barycentric and classic Lagrange give the same curve), one interpolant per column for everything else
+std::shared_ptr<const SeriesInterpolant> Interpolator::createSeriesInterpolant(const std::vector<double> &x_points,
+                                                                              const std::vector<std::vector<double>> &y_columns) const
+{
+    if (x_points.empty())
+        throw std::invalid_argument("No points to interpolate");
+    for (const std::vector<double> &column : y_columns)
+        if (column.size() != x_points.size())
+            throw std::invalid_argument("Incomplete point input");
+
+    std::vector<size_t> order(x_points.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (!std::is_sorted(x_points.begin(), x_points.end()))
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return x_points[a] < x_points[b]; });
+
+    std::vector<double> sorted_x(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        sorted_x[i] = x_points[order[i]];
+    for (size_t i = 1; i < sorted_x.size(); ++i)
+        if (sorted_x[i] == sorted_x[i - 1])
+            throw std::invalid_argument("Duplicate X value in interpolation input");
+
+    std::vector<std::vector<double>> sorted_columns(y_columns.size(), std::vector<double>(order.size()));
+    for (size_t s = 0; s < y_columns.size(); ++s)
+        for (size_t i = 0; i < order.size(); ++i)
+            sorted_columns[s][i] = y_columns[s][order[i]];
+
+    if (currentMethod == Method::Barycentric || currentMethod == Method::Lagrange)
+        return std::make_shared<SeriesInterpolant>(std::move(sorted_x), std::move(sorted_columns));
+
+    std::vector<std::shared_ptr<const Interpolant>> interpolants;
+    interpolants.reserve(sorted_columns.size());
+    for (std::vector<double> &column : sorted_columns)
+        interpolants.push_back(buildInterpolant(sorted_x, std::move(column)));
+
+    return std::make_shared<SeriesInterpolant>(std::move(interpolants));
+}
+
+// Definite integrals of the selected interpolant, one per (from, to) range
+std::vector<double> Interpolator::computeIntegrals(const std::vector<double> &x_points,
+                                                   const std::vector<double> &y_points,
+                                                   const std::vector<std::pair<double, double>> &ranges) const
+{
+    std::shared_ptr<const Interpolant> interpolant = createInterpolant(x_points, y_points);
+
+    std::vector<double> result(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i)
+        result[i] = interpolant->integral(ranges[i].first, ranges[i].second);
+
+    return result;
+}
+
+// Allocation-free variant writing into caller-owned buffers of outputSize(count, depth) elements.
+// Barycentric and classic Lagrange run entirely out of the workspace on the calling thread;
+// other methods still build a temporary interpolant. Returns the tier the values were computed with.
+Interpolator::Precision Interpolator::computeInterpolatedData(const double *x_points,
+                                                             const double *y_points,
+                                                             size_t count,
+                                                             int depth,
+                                                             double *dense_x,
+                                                             double *dense_y,
+                                                             Workspace &workspace) const
+{
+    if (count == 0)
+        throw std::invalid_argument("No points to interpolate");
+
+    // Re-derive the order and weights only when the x-values changed since the last call
+    bool sameX = workspace.inputX.size() == count && std::equal(x_points, x_points + count, workspace.inputX.begin());
+    if (!sameX) {
+        workspace.inputX.assign(x_points, x_points + count);
+        workspace.order.resize(count);
+        std::iota(workspace.order.begin(), workspace.order.end(), 0);
+        if (!std::is_sorted(x_points, x_points + count))
+            std::sort(workspace.order.begin(), workspace.order.end(), [&](size_t a, size_t b) { return x_points[a] < x_points[b]; });
+
+        workspace.sortedX.resize(count);
+        for (size_t i = 0; i < count; ++i)
+            workspace.sortedX[i] = x_points[workspace.order[i]];
+        workspace.weightsValid = false;
+    }
+
+    workspace.sortedY.resize(count);
+    for (size_t i = 0; i < count; ++i)
+        workspace.sortedY[i] = y_points[workspace.order[i]];
+
+    denseGrid(workspace.sortedX.data(), count, depth, dense_x);
+    size_t total = outputSize(count, depth);
+
+    if (currentMethod == Method::Barycentric) {
+        if (!workspace.weightsValid) {
+            for (size_t i = 1; i < count; ++i)
+                if (workspace.sortedX[i] == workspace.sortedX[i - 1])
+                    throw std::invalid_argument("Duplicate X value in interpolation input");
+
+            workspace.weights.resize(count);
+            workspace.exponents.resize(count);
+            BarycentricInterpolant::computeWeights(workspace.sortedX.data(), count, workspace.weights.data(), workspace.exponents.data());
+            workspace.weightsValid = true;
+        }
+
+        if (currentPrecision == Precision::Single) {
+            double center, scale;
+            BarycentricInterpolant::narrow(workspace.sortedX, workspace.sortedY, workspace.weights,
+                                           workspace.singleX, workspace.singleY, workspace.singleWeights, center, scale);
+            Simd::evaluateBarycentric(workspace.singleX.data(), workspace.singleY.data(), workspace.singleWeights.data(), count,
+                                      center, scale, dense_x, dense_y, total);
+        } else if (currentPrecision == Precision::Compensated) {
+            Simd::evaluateBarycentricCompensated(workspace.sortedX.data(), workspace.sortedY.data(), workspace.weights.data(), count, dense_x, dense_y, total);
+        } else {
+            Simd::evaluateBarycentric(workspace.sortedX.data(), workspace.sortedY.data(), workspace.weights.data(), count, dense_x, dense_y, total);
+        }
+
+        return currentPrecision;
+    }
+    if (currentMethod == Method::Lagrange) {
+        if (!FixedLagrange::evaluate(workspace.sortedX.data(), workspace.sortedY.data(), count, dense_x, dense_y, total))
+            for (size_t i = 0; i < total; ++i)
+                dense_y[i] = evaluateLagrange(workspace.sortedX, workspace.sortedY, dense_x[i]);
+
+        return Precision::Double;
+    }
+
+    std::shared_ptr<const Interpolant> interpolant = buildInterpolant(workspace.sortedX, workspace.sortedY);
+    ParallelEvaluator().evaluate(*interpolant, dense_x, dense_y, total);
+
+    return interpolant->precision();
+}
+
+// Number of dense samples produced for count points at the given depth
+size_t Interpolator::outputSize(size_t pointCount,
+                                int depth)
+{
+    return GridGenerator::gridSize(pointCount, depth);
+}
+
+// Evaluates an existing interpolant on the dense grid derived from its sorted nodes
+Interpolator::InterpolatedData Interpolator::evaluateOnGrid(const Interpolant &interpolant,
+                                                            const std::vector<double> &sorted_x,
+                                                            int depth)
+{
+    InterpolatedData data;
+    evaluateOnGrid(interpolant, sorted_x, depth, data);
+
+    return data;            // Return the new, dense set of x and y values
+}
+
+// Same, writing into data and reusing its capacity, so a buffer that already holds outputSize() samples allocates nothing
+void Interpolator::evaluateOnGrid(const Interpolant &interpolant,
+                                  const std::vector<double> &sorted_x,
+                                  int depth,
+                                  InterpolatedData &data)
+{
+    // Generate a denser set of x-values and evaluate them across all cores
+    size_t total = outputSize(sorted_x.size(), depth);
+    data.dense_x.resize(total);
+    data.dense_y.resize(total);
+    denseGrid(sorted_x.data(), sorted_x.size(), depth, data.dense_x.data());
+    ParallelEvaluator().evaluate(interpolant, data.dense_x.data(), data.dense_y.data(), total);
+    data.precision = interpolant.precision();
+}
+
+// Evaluates the grid for depth, reusing the samples of the grid computed at previousDepth whenever one grid
+// contains the other: (depth + 1) a multiple of (previousDepth + 1) keeps every old sample and evaluates only
+// the new ones, the reverse only picks samples out. Other depths are evaluated from scratch.
+Interpolator::InterpolatedData Interpolator::refineOnGrid(const Interpolant &interpolant,
+                                                          const std::vector<double> &sorted_x,
+                                                          int depth,
+                                                          const InterpolatedData &previous,
+                                                          int previousDepth)
+{
+    InterpolatedData data;
+    Workspace workspace;
+    refineOnGrid(interpolant, sorted_x, depth, previous, previousDepth, data, workspace);
+
+    return data;
+}
+
+// Same, writing into data (which must not be previous) with the index and sample scratch kept in workspace
+void Interpolator::refineOnGrid(const Interpolant &interpolant,
+                                const std::vector<double> &sorted_x,
+                                int depth,
+                                const InterpolatedData &previous,
+                                int previousDepth,
+                                InterpolatedData &data,
+                                Workspace &workspace)
+{
+    size_t segments = static_cast<size_t>(std::max(depth, 0)) + 1;
+    size_t previousSegments = static_cast<size_t>(std::max(previousDepth, 0)) + 1;
+    bool finer = segments % previousSegments == 0;
+    bool coarser = previousSegments % segments == 0;
+    if (sorted_x.empty() || (!finer && !coarser) || previous.dense_x.size() != outputSize(sorted_x.size(), previousDepth)) {
+        evaluateOnGrid(interpolant, sorted_x, depth, data);
+        return;
+    }
+
+    size_t total = outputSize(sorted_x.size(), depth);
+    data.precision = previous.precision;
+    data.dense_x.resize(total);
+    data.dense_y.resize(total);
+
+    if (coarser) {
+        size_t stride = previousSegments / segments;
+        for (size_t i = 0; i < total; ++i) {
+            data.dense_x[i] = previous.dense_x[i * stride];
+            data.dense_y[i] = previous.dense_y[i * stride];
+        }
+
+        return;
+    }
+
+    // Sample j of an interval lies on the old grid when it is a multiple of the refinement factor
+    denseGrid(sorted_x.data(), sorted_x.size(), depth, data.dense_x.data());
+    size_t factor = segments / previousSegments;
+    std::vector<size_t> &fresh = workspace.fresh;
+    fresh.clear();
+    for (size_t i = 0; i < total; ++i) {
+        size_t j = i % segments;
+        if (j % factor != 0) {
+            fresh.push_back(i);
+            continue;
+        }
+
+        size_t old = (i / segments) * previousSegments + j / factor;
+        data.dense_x[i] = previous.dense_x[old];            // Bitwise the x the old value belongs to
+        data.dense_y[i] = previous.dense_y[old];
+    }
+
+    workspace.freshX.resize(fresh.size());
+    workspace.freshY.resize(fresh.size());
+    for (size_t k = 0; k < fresh.size(); ++k)
+        workspace.freshX[k] = data.dense_x[fresh[k]];
+    ParallelEvaluator().evaluate(interpolant, workspace.freshX.data(), workspace.freshY.data(), fresh.size());
+    for (size_t k = 0; k < fresh.size(); ++k)
+        data.dense_y[fresh[k]] = workspace.freshY[k];
+}
+
+// Sorts a copy of the points and builds the interpolant for the selected method
+std::shared_ptr<const Interpolant> Interpolator::createInterpolant(const std::vector<double> &x_points,
+                                                                   const std::vector<double> &y_points) const
 {
     // Ensure x and y data are of equal size
     if (x_points.size() != y_points.size())
         throw std::invalid_argument("Incomplete point input");
+    if (x_points.empty())
+        throw std::invalid_argument("No points to interpolate");
+
+    std::vector<double> x = x_points;
+    std::vector<double> y = y_points;
+    sortPoints(x, y);           // Ensure the points are ordered
+
+    return buildInterpolant(std::move(x), std::move(y));
+}
+
+// Builds the interpolant for the selected method from points already sorted by x
+std::shared_ptr<const Interpolant> Interpolator::buildInterpolant(std::vector<double> x,
+                                                                  std::vector<double> y) const
+{
+    if (currentMethod == Method::Lagrange) {
+        // Small sessions get a kernel unrolled for their exact point count
+        if (std::shared_ptr<const Interpolant> fixed = FixedLagrange::create(x, y))
+            return fixed;
+
+        return std::make_shared<LagrangeInterpolant>(std::move(x), std::move(y));
+    }
+    if (currentMethod == Method::Newton)
+        return std::make_shared<NewtonInterpolant>(x, y);
+    if (currentMethod == Method::Chebyshev) {
+        if (x.size() < 2)
+            throw std::invalid_argument("Chebyshev interpolation needs at least two points");
+
+        // Power-of-two node counts keep the DCT on the O(n log n) FFT path
+        size_t n = std::min(Fft::nextPowerOfTwo(std::max<size_t>(x.size(), 16)), MaxChebyshevNodes);
+        double a = x.front();
+        double b = x.back();
+
+        // Resample with a local cubic through the four nearest points, walking the nodes in ascending order
+        std::vector<double> nodes = ChebyshevInterpolant::nodes(n, a, b);
+        std::reverse(nodes.begin(), nodes.end());
+        std::vector<double> samples(n);
+        LocalLagrangeInterpolant(std::move(x), std::move(y), 4).evaluate(nodes.data(), samples.data(), n);
+        std::reverse(samples.begin(), samples.end());
+
+        return std::make_shared<ChebyshevInterpolant>(ChebyshevInterpolant::fromSamples(samples, a, b));
+    }
+    if (currentMethod == Method::LocalLagrange)
+        return std::make_shared<LocalLagrangeInterpolant>(std::move(x), std::move(y), localWindow);
+    if (currentMethod == Method::NaturalSpline)
+        return std::make_shared<CubicSplineInterpolant>(std::move(x), std::move(y));
+    if (currentMethod == Method::ClampedSpline) {
+        if (x.size() < 2)
+            throw std::invalid_argument("Spline interpolation needs at least two points");
+
+        double startSlope = CubicSplineInterpolant::estimateStartSlope(x, y);
+        double endSlope = CubicSplineInterpolant::estimateEndSlope(x, y);
+
+        return std::make_shared<CubicSplineInterpolant>(std::move(x), std::move(y), CubicSplineInterpolant::Boundary::Clamped, startSlope, endSlope);
+    }
+    if (currentMethod == Method::Akima)
+        return std::make_shared<AkimaInterpolant>(std::move(x), std::move(y));
+    if (currentMethod == Method::FloaterHormann) {
+        std::shared_ptr<FloaterHormannInterpolant> rational = std::make_shared<FloaterHormannInterpolant>(std::move(x), std::move(y), blending);
+        rational->setPrecision(currentPrecision);
+
+        return rational;
+    }
+    if (currentMethod == Method::LeastSquares)
+        return std::make_shared<ChebyshevInterpolant>(ChebyshevInterpolant::fitLeastSquares(x, y, fittedDegree));
+
+    std::shared_ptr<BarycentricInterpolant> barycentric = std::make_shared<BarycentricInterpolant>(std::move(x), std::move(y));
+    barycentric->setPrecision(currentPrecision);
+
+    return barycentric;
+}
+
+// Generates depth extra x-values evenly spaced inside every interval of the sorted input
+std::vector<double> Interpolator::denseGrid(const std::vector<double> &sorted_x,
+                                            int depth)
+{
+    std::vector<double> dense_x(outputSize(sorted_x.size(), depth));
+    denseGrid(sorted_x.data(), sorted_x.size(), depth, dense_x.data());
 
-    // Store and sort the input data
-    setData(x_points, y_points);
+    return dense_x;
+}
+
+// Writes the dense grid into a caller-owned buffer of outputSize(count, depth) elements
+void Interpolator::denseGrid(const double *sorted_x,
+                             size_t count,
+                             int depth,
+                             double *dense_x)
+{
+    if (count == 0)
+        return;
 
-    // Generate a denser set of x-values between each input interval
-    std::vector<double> dense_x;
-    for (size_t i = 0; i < xi.size() - 1; ++i) {
-        double start = xi[i];
-        double end = xi[i + 1];
-        int segments = depth + 1;           // Number of subdivisions per interval
+    size_t index = 0;
+    int segments = std::max(depth, 0) + 1;          // Number of subdivisions per interval
+    for (size_t i = 0; i < count - 1; ++i) {
+        double start = sorted_x[i];
+        double end = sorted_x[i + 1];
         for (int j = 0; j < segments; ++j) {
             // Linearly interpolate x-values between start and end
-            double val = start + (end - start) * j / segments;
-            dense_x.push_back(val);
+            dense_x[index++] = start + (end - start) * j / segments;
         }
     }
 
-    dense_x.push_back(xi.back());           // Add the last x point to complete the range
+    dense_x[index] = sorted_x[count - 1];           // Add the last x point to complete the range
+}
+
+// Sorts the input points in ascending order of x through an index permutation, skipped when already sorted
+void Interpolator::sortPoints(std::vector<double> &x,
+                              std::vector<double> &y)
+{
+    if (std::is_sorted(x.begin(), x.end()))
+        return;
+
+    std::vector<size_t> order(x.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return x[a] < x[b]; });            // Sort indices based on x value
 
-    // Compute the interpolated y-values using Lagrange polynomial for each dense x
-    std::vector<double> dense_y;
-    for (double x : dense_x) {
-        dense_y.push_back(evaluateLagrange(xi, yi, x));
+    // Apply the permutation to both columns
+    std::vector<double> sorted_x(x.size()), sorted_y(y.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        sorted_x[i] = x[order[i]];
+        sorted_y[i] = y[order[i]];
     }
+    x.swap(sorted_x);
+    y.swap(sorted_y);
+}
 
-    return {dense_x, dense_y};          // Return the new, dense set of x and y values
+// Selects the evaluation engine used by computeInterpolatedData
+void Interpolator::setMethod(Method method)
+{
+    currentMethod = method;
 }
 
-// Stores and sorts the data points by x-coordinate
-void Interpolator::setData(const std::vector<double> &x,
-                           const std::vector<double> &y)
+// Returns the currently selected evaluation engine
+Interpolator::Method Interpolator::method() const
 {
-    xi = x;
-    yi = y;
-    sortPoints();           // Ensure the points are ordered
+    return currentMethod;
 }
 
-// Sorts the input points in ascending order of x
-void Interpolator::sortPoints()
+// Sets how many nearest nodes the local Lagrange method uses per query
+void Interpolator::setWindowSize(size_t window)
 {
-    // Combine x and y into pairs
-    std::vector<std::pair<double, double>> points;
-    for (size_t i = 0; i < xi.size(); ++i)
-        points.emplace_back(xi[i], yi[i]);
-    std::sort(points.begin(), points.end(), [](auto &a, auto &b) { return a.first < b.first; });            // Sort pairs based on x value
+    localWindow = std::max<size_t>(window, 2);
+}
 
-    // Separate the sorted pairs back into xi and yi
-    xi.clear();
-    yi.clear();
-    for (auto &p : points) {
-        xi.push_back(p.first);
-        yi.push_back(p.second);
-    }
+// Returns the local Lagrange window size
+size_t Interpolator::windowSize() const
+{
+    return localWindow;
+}
+
+// Sets the Floater-Hormann blending degree d; 0 is the Berrut interpolant, n - 1 the global polynomial
+void Interpolator::setBlendingDegree(size_t degree)
+{
+    blending = degree;
+}
+
+// Returns the Floater-Hormann blending degree
+size_t Interpolator::blendingDegree() const
+{
+    return blending;
+}
+
+// Sets the degree of the least-squares fit
+void Interpolator::setFitDegree(size_t degree)
+{
+    fittedDegree = degree;
+}
+
+// Returns the degree of the least-squares fit
+size_t Interpolator::fitDegree() const
+{
+    return fittedDegree;
+}
+
+// Selects the arithmetic tier used by the barycentric method
+void Interpolator::setPrecision(Precision precision)
+{
+    currentPrecision = precision;
+}
+
+// Returns the requested arithmetic tier
+Interpolator::Precision Interpolator::precision() const
+{
+    return currentPrecision;
+}
+
+// Selects the cheapest tier expected to reach the given relative accuracy
+void Interpolator::setTolerance(double relativeTolerance)
+{
+    currentPrecision = precisionForTolerance(relativeTolerance);
+}
+
+// Maps a relative accuracy goal to a tier: float is good to about 1e-6 on well-conditioned data
+// and double to about 1e-13, anything tighter needs the compensated sums
+Interpolator::Precision Interpolator::precisionForTolerance(double relativeTolerance)
+{
+    if (relativeTolerance >= 1e-5)
+        return Precision::Single;
+    if (relativeTolerance >= 1e-12)
+        return Precision::Double;
+
+    return Precision::Compensated;
 }
 
 // Evaluates the Lagrange interpolating polynomial at a given x
@@ -1,23 +1,117 @@
 #ifndef INTERPOLATOR_H
 #define INTERPOLATOR_H
 
+#include "interpolant.h"
+#include "seriesinterpolant.h"
+
+#include <memory>
+#include <utility>
 #include <vector>
 
 class Interpolator
 {
 public:
-    double evaluateLagrange(const std::vector<double> &x_points, const std::vector<double> &y_points, double x);
+    // Evaluation engine used by computeInterpolatedData
+    enum class Method
+    {
+        Lagrange,           // Classic Lagrange form, O(n²) per evaluated x
+        Barycentric,            // Second-form barycentric Lagrange with cached weights, O(n) per evaluated x
+        Newton,         // Newton divided differences with Horner evaluation, O(n) per evaluated x
+        Chebyshev,          // Data resampled onto Chebyshev nodes, DCT coefficients, Clenshaw evaluation
+        LocalLagrange,          // Lagrange through the k nearest nodes only, O(k) per evaluated x
+        NaturalSpline,          // C² cubic spline with zero curvature at the ends, O(n) build
+        ClampedSpline,          // C² cubic spline with end slopes estimated from the data, O(n) build
+        Akima,          // Akima spline, local slopes that resist overshoot, O(n) build
+        FloaterHormann,         // Floater-Hormann barycentric rational, O(n d) build, O(n) per evaluated x
+        LeastSquares            // Least-squares Chebyshev series of a chosen degree m, not through every point, O(n m²) build
+    };
+    using Precision = Interpolant::Precision;
+
+    // Scratch memory reused across allocation-free computeInterpolatedData calls.
+    // Once it has grown to the largest dataset seen, recomputes allocate nothing; unchanged x-values
+    // (e.g. only the depth moved) also skip the sort and the O(n²) weight derivation.
+    class Workspace
+    {
+    private:
+        friend class Interpolator;
+        std::vector<double> inputX;         // Raw x-values the cached order and weights belong to
+        std::vector<size_t> order;          // Sorting permutation of inputX
+        std::vector<double> sortedX, sortedY, weights;
+        std::vector<float> singleX, singleY, singleWeights;
+        std::vector<int> exponents;
+        bool weightsValid = false;
+        std::vector<size_t> fresh;          // Grid positions refineOnGrid has to evaluate
+        std::vector<double> freshX, freshY;
+    };
+
+    static double evaluateLagrange(const std::vector<double> &x_points, const std::vector<double> &y_points, double x);
     struct InterpolatedData
     {
         std::vector<double> dense_x;
         std::vector<double> dense_y;
+        Precision precision = Precision::Double;            // Tier the values were actually computed with
+    };
+    InterpolatedData computeInterpolatedData(const std::vector<double> &x_points, const std::vector<double> &y_points, int depth) const;
+    struct DerivativeData
+    {
+        std::vector<double> dense_x;
+        std::vector<double> first;
+        std::vector<double> second;
+    };
+    DerivativeData computeDerivatives(const std::vector<double> &x_points, const std::vector<double> &y_points, int depth) const;
+    static DerivativeData derivativesOnGrid(const Interpolant &interpolant, const std::vector<double> &sorted_x, int depth);
+    struct SeriesData
+    {
+        std::vector<double> dense_x;
+        std::vector<std::vector<double>> dense_y;           // One column per input series
+    };
+    SeriesData computeInterpolatedSeries(const std::vector<double> &x_points, const std::vector<std::vector<double>> &y_columns, int depth) const;
+    struct SurfaceData
+    {
+        std::vector<double> dense_x;            // Column coordinates, ascending
+        std::vector<double> dense_y;            // Row coordinates, ascending
+        std::vector<double> dense_z;            // Row-major, dense_y.size() rows of dense_x.size() values
     };
-    InterpolatedData computeInterpolatedData(const std::vector<double> &x_points, const std::vector<double> &y_points, int depth);
+    SurfaceData computeInterpolatedSurface(const std::vector<double> &x_points, const std::vector<double> &y_points,
+                                           const std::vector<double> &z_values, int depth) const;
+    std::shared_ptr<const SeriesInterpolant> createSeriesInterpolant(const std::vector<double> &x_points,
+                                                                     const std::vector<std::vector<double>> &y_columns) const;
+    std::vector<double> computeIntegrals(const std::vector<double> &x_points, const std::vector<double> &y_points,
+                                         const std::vector<std::pair<double, double>> &ranges) const;
+    Precision computeInterpolatedData(const double *x_points, const double *y_points, size_t count, int depth,
+                                      double *dense_x, double *dense_y, Workspace &workspace) const;
+    static size_t outputSize(size_t pointCount, int depth);
+    static InterpolatedData evaluateOnGrid(const Interpolant &interpolant, const std::vector<double> &sorted_x, int depth);
+    static InterpolatedData refineOnGrid(const Interpolant &interpolant, const std::vector<double> &sorted_x, int depth,
+                                         const InterpolatedData &previous, int previousDepth);
+    static void evaluateOnGrid(const Interpolant &interpolant, const std::vector<double> &sorted_x, int depth, InterpolatedData &data);
+    static void refineOnGrid(const Interpolant &interpolant, const std::vector<double> &sorted_x, int depth,
+                             const InterpolatedData &previous, int previousDepth, InterpolatedData &data, Workspace &workspace);
+    std::shared_ptr<const Interpolant> createInterpolant(const std::vector<double> &x_points, const std::vector<double> &y_points) const;
+    static std::vector<double> denseGrid(const std::vector<double> &sorted_x, int depth);
+    static void denseGrid(const double *sorted_x, size_t count, int depth, double *dense_x);
+
+    void setMethod(Method method);
+    Method method() const;
+    void setWindowSize(size_t window);
+    size_t windowSize() const;
+    void setBlendingDegree(size_t degree);
+    size_t blendingDegree() const;
+    void setFitDegree(size_t degree);
+    size_t fitDegree() const;
+    void setPrecision(Precision precision);
+    Precision precision() const;
+    void setTolerance(double relativeTolerance);
+    static Precision precisionForTolerance(double relativeTolerance);
 
 private:
-    std::vector<double> xi, yi;
-    void setData(const std::vector<double> &x, const std::vector<double> &y);
-    void sortPoints();
+    Method currentMethod = Method::Barycentric;
+    size_t localWindow = 6;         // Nodes per local Lagrange window
+    size_t blending = FloaterHormannInterpolant::DefaultDegree;         // Floater-Hormann d, clamped to n - 1 per dataset
+    size_t fittedDegree = 8;            // Least-squares degree m, clamped to n - 1 per dataset
+    Precision currentPrecision = Precision::Double;         // Honored by the barycentric and Floater-Hormann methods, the others always run in double
+    std::shared_ptr<const Interpolant> buildInterpolant(std::vector<double> x, std::vector<double> y) const;
+    static void sortPoints(std::vector<double> &x, std::vector<double> &y);
 };
 
 #endif //INTERPOLATOR_H
@@ -0,0 +1,109 @@
+#include "leastsquaresfit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+LeastSquaresFit::LeastSquaresFit(size_t columns)
+    : p(columns)
+    , r(columns * columns, 0.0)
+    , qty(columns, 0.0)
+{
+    if (columns == 0)
+        throw std::invalid_argument("Least-squares fit needs at least one column");
+}
+
+// Folds count rows (row-major, p values each) and their right-hand sides into R and Q^T y.
+// Column k of the stacked [R; block] is nonzero only in row k of R and in the block, so each
+// reflection touches p + 1 - k entries of R and the block rows and never the zeros below R's diagonal.
+void LeastSquaresFit::addRows(const double *rows,
+                              const double *values,
+                              size_t count)
+{
+    if (count == 0)
+        return;
+
+    std::vector<double> block(rows, rows + count * p);
+    std::vector<double> rhs(values, values + count);
+
+    for (size_t k = 0; k < p; ++k) {
+        double diagonal = r[k * p + k];
+        double sigma = 0.0;
+        for (size_t i = 0; i < count; ++i)
+            sigma += block[i * p + k] * block[i * p + k];
+        if (sigma == 0.0)
+            continue;           // Column already triangular, the reflection would be the identity
+
+        // Reflection v = [1; block(:, k) / (diagonal - beta)] mapping (diagonal, block(:, k)) onto (beta, 0)
+        double beta = -std::copysign(std::sqrt(diagonal * diagonal + sigma), diagonal);
+        double scale = 1.0 / (diagonal - beta);
+        double tau = (beta - diagonal) / beta;
+        for (size_t i = 0; i < count; ++i)
+            block[i * p + k] *= scale;
+        r[k * p + k] = beta;
+
+        for (size_t j = k + 1; j < p; ++j) {
+            double s = r[k * p + j];
+            for (size_t i = 0; i < count; ++i)
+                s += block[i * p + k] * block[i * p + j];
+            s *= tau;
+
+            r[k * p + j] -= s;
+            for (size_t i = 0; i < count; ++i)
+                block[i * p + j] -= s * block[i * p + k];
+        }
+
+        double s = qty[k];
+        for (size_t i = 0; i < count; ++i)
+            s += block[i * p + k] * rhs[i];
+        s *= tau;
+
+        qty[k] -= s;
+        for (size_t i = 0; i < count; ++i)
+            rhs[i] -= s * block[i * p + k];
+    }
+
+    // What is left of the right-hand side lies outside the column space of A
+    for (double value : rhs)
+        residualSquares += value * value;
+    rowsSeen += count;
+}
+
+// Back substitution R c = Q^T y
+std::vector<double> LeastSquaresFit::solve() const
+{
+    // Diagonal entries negligible next to the largest one mean dependent columns, e.g. too few distinct x-values
+    double largest = 0.0;
+    for (size_t k = 0; k < p; ++k)
+        largest = std::max(largest, std::fabs(r[k * p + k]));
+
+    std::vector<double> c(p, 0.0);
+    for (size_t k = p; k-- > 0;) {
+        if (!(std::fabs(r[k * p + k]) > largest * 1e-13))
+            throw std::invalid_argument("Not enough distinct points for the requested fit degree");
+
+        double sum = qty[k];
+        for (size_t j = k + 1; j < p; ++j)
+            sum -= r[k * p + j] * c[j];
+        c[k] = sum / r[k * p + k];
+    }
+
+    return c;
+}
+
+size_t LeastSquaresFit::columns() const
+{
+    return p;
+}
+
+size_t LeastSquaresFit::rowCount() const
+{
+    return rowsSeen;
+}
+
+// Euclidean norm of the residual A c - y at the solution
+double LeastSquaresFit::residualNorm() const
+{
+    return std::sqrt(residualSquares);
+}
@@ -0,0 +1,32 @@
+#ifndef LEASTSQUARESFIT_H
+#define LEASTSQUARESFIT_H
+
+#include <cstddef>
+#include <vector>
+
+// Linear least-squares solver min |A c - y| that takes the rows of A in blocks.
+// Each block is stacked under the current p x p triangular factor R and folded into it with Householder
+// reflections, so memory stays at O(block p) and the whole fit costs O(n p²) for n rows.
+class LeastSquaresFit
+{
+public:
+    static constexpr size_t BlockRows = 256;            // Rows a caller should gather per addRows call
+
+    explicit LeastSquaresFit(size_t columns);
+
+    void addRows(const double *rows, const double *values, size_t count);
+    std::vector<double> solve() const;
+
+    size_t columns() const;
+    size_t rowCount() const;
+    double residualNorm() const;
+
+private:
+    size_t p;
+    size_t rowsSeen = 0;
+    std::vector<double> r;          // Upper triangular factor, row-major p x p
+    std::vector<double> qty;            // First p entries of Q^T y
+    double residualSquares = 0.0;           // |Q^T y|² beyond the first p entries, the squared residual
+};
+
+#endif //LEASTSQUARESFIT_H
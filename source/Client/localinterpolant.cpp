@@ -0,0 +1,157 @@
+#include "localinterpolant.h"
+#include "simdkernels.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+
+LocalLagrangeInterpolant::LocalLagrangeInterpolant(std::vector<double> x,
+                                                   std::vector<double> y,
+                                                   size_t window)
+    : xi(std::move(x))
+    , yi(std::move(y))
+    , k(std::min(std::max<size_t>(window, 1), xi.size()))
+{
+    if (xi.size() != yi.size())
+        throw std::invalid_argument("Incomplete point input");
+    if (xi.empty())
+        throw std::invalid_argument("No points to interpolate");
+}
+
+// Evaluates a single x: binary search for the window, then O(k²) weights and O(k) evaluation
+double LocalLagrangeInterpolant::evaluate(double x) const
+{
+    size_t upper = std::lower_bound(xi.begin(), xi.end(), x) - xi.begin();
+    size_t first = windowStart(upper);
+
+    std::vector<double> weights(k);
+    windowWeights(first, weights.data());
+
+    return evaluateWindow(first, weights.data(), x);
+}
+
+// Evaluates count x-values; ascending runs advance the cursor instead of searching again
+void LocalLagrangeInterpolant::evaluate(const double *x,
+                                        double *y,
+                                        size_t count) const
+{
+    std::vector<double> weights(k);
+    size_t current = xi.size();         // Start of the window the weights belong to, none yet
+    size_t upper = 0;           // First node not below the current x
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i == 0 || x[i] < x[i - 1]) {
+            upper = std::lower_bound(xi.begin(), xi.end(), x[i]) - xi.begin();
+        } else {
+            while (upper < xi.size() && xi[upper] < x[i])
+                ++upper;
+        }
+
+        size_t first = windowStart(upper);
+        if (first != current) {
+            windowWeights(first, weights.data());
+            current = first;
+        }
+
+        y[i] = evaluateWindow(first, weights.data(), x[i]);
+    }
+}
+
+// First or second derivative of the local polynomial at count x-values. Runs of x sharing a window go through
+// the closed-form barycentric kernel together, with the window located as in evaluate
+void LocalLagrangeInterpolant::derivative(const double *x,
+                                          double *dy,
+                                          size_t count,
+                                          int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    std::vector<double> weights(k);
+    size_t upper = 0;
+    size_t i = 0;
+    while (i < count) {
+        upper = std::lower_bound(xi.begin(), xi.end(), x[i]) - xi.begin();
+        size_t first = windowStart(upper);
+        windowWeights(first, weights.data());
+
+        // Extend the run while ascending x stays in the same window
+        size_t end = i + 1;
+        for (; end < count && x[end] >= x[end - 1]; ++end) {
+            while (upper < xi.size() && xi[upper] < x[end])
+                ++upper;
+            if (windowStart(upper) != first)
+                break;
+        }
+
+        Simd::evaluateBarycentricDerivatives(xi.data() + first, yi.data() + first, weights.data(), k, x + i,
+                                             order == 1 ? dy + i : nullptr, order == 2 ? dy + i : nullptr, end - i);
+        i = end;
+    }
+}
+
+// Exact definite integral: the window only changes at nodes, so [a, b] is broken at every node inside it
+// and each piece, a polynomial of degree k - 1, gets enough 8-point panels to integrate it exactly
+double LocalLagrangeInterpolant::integral(double a,
+                                          double b) const
+{
+    if (b < a)
+        return -integral(b, a);
+
+    std::vector<double> breaks;
+    breaks.reserve(xi.size() + 2);
+    breaks.push_back(a);
+    breaks.insert(breaks.end(), std::upper_bound(xi.begin(), xi.end(), a), std::lower_bound(xi.begin(), xi.end(), b));
+    breaks.push_back(b);
+
+    return gaussLegendre(breaks, (k + 15) / 16);
+}
+
+size_t LocalLagrangeInterpolant::window() const
+{
+    return k;
+}
+
+// Window of k nodes centered on the interval that ends at node upper, clamped to the data
+size_t LocalLagrangeInterpolant::windowStart(size_t upper) const
+{
+    size_t first = upper > k / 2 ? upper - k / 2 : 0;
+
+    return std::min(first, xi.size() - k);
+}
+
+// Barycentric weights of the k nodes starting at first
+void LocalLagrangeInterpolant::windowWeights(size_t first,
+                                             double *weights) const
+{
+    for (size_t i = 0; i < k; ++i) {
+        double product = 1.0;
+        for (size_t j = 0; j < k; ++j)
+            if (j != i)
+                product *= xi[first + i] - xi[first + j];
+
+        weights[i] = 1.0 / product;
+    }
+}
+
+// Second-form barycentric evaluation restricted to the window
+double LocalLagrangeInterpolant::evaluateWindow(size_t first,
+                                                const double *weights,
+                                                double x) const
+{
+    double numerator = 0.0;
+    double denominator = 0.0;
+
+    for (size_t i = 0; i < k; ++i) {
+        double diff = x - xi[first + i];
+        if (diff == 0.0)
+            return yi[first + i];
+
+        double term = weights[i] / diff;
+        numerator += term * yi[first + i];
+        denominator += term;
+    }
+
+    return numerator / denominator;
+}
@@ -0,0 +1,35 @@
+#ifndef LOCALINTERPOLANT_H
+#define LOCALINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <vector>
+
+// Piecewise Lagrange interpolation through the k nodes nearest to each query.
+// Batch evaluation of ascending x slides the window forward with a moving cursor and re-derives the
+// k window weights only when the window shifts, so each sample costs O(k) regardless of the point count.
+class LocalLagrangeInterpolant : public Interpolant
+{
+public:
+    static constexpr size_t DefaultWindow = 6;
+
+    LocalLagrangeInterpolant(std::vector<double> x, std::vector<double> y, size_t window = DefaultWindow);
+
+    double evaluate(double x) const override;
+    void evaluate(const double *x, double *y, size_t count) const override;
+
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+    double integral(double a, double b) const override;
+
+    size_t window() const;
+
+private:
+    std::vector<double> xi, yi;
+    size_t k;
+
+    size_t windowStart(size_t upper) const;
+    void windowWeights(size_t first, double *weights) const;
+    double evaluateWindow(size_t first, const double *weights, double x) const;
+};
+
+#endif //LOCALINTERPOLANT_H
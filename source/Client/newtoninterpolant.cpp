@@ -0,0 +1,124 @@
+#include "newtoninterpolant.h"
+#include "chebyshevinterpolant.h"
+#include "simdkernels.h"
+
+#include <stdexcept>
+#include <utility>
+
+
+// Builds the divided-difference table by appending the points one at a time, O(n²) overall
+NewtonInterpolant::NewtonInterpolant(const std::vector<double> &x,
+                                     const std::vector<double> &y)
+{
+    if (x.size() != y.size())
+        throw std::invalid_argument("Incomplete point input");
+
+    xi.reserve(x.size());
+    coeffs.reserve(x.size());
+    diagonal.reserve(x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+        append(x[i], y[i]);
+}
+
+// Restores a previously exported polynomial; it can be evaluated but not extended
+NewtonInterpolant NewtonInterpolant::fromCoefficients(std::vector<double> centers,
+                                                      std::vector<double> coefficients)
+{
+    if (!coefficients.empty() && centers.size() + 1 < coefficients.size())
+        throw std::invalid_argument("Newton form needs one center per coefficient after the first");
+
+    NewtonInterpolant result;
+    result.xi = std::move(centers);
+    result.coeffs = std::move(coefficients);
+    result.xi.resize(result.coeffs.empty() ? 0 : result.coeffs.size() - 1);
+
+    return result;
+}
+
+// Adds a point in O(n) by extending the last row of the divided-difference table
+void NewtonInterpolant::append(double x,
+                               double y)
+{
+    if (diagonal.size() != coeffs.size())
+        throw std::logic_error("Cannot append to a Newton polynomial restored from coefficients");
+
+    size_t n = xi.size();
+    std::vector<double> row(n + 1);
+    row[0] = y;         // f[x_n]
+    for (size_t k = 1; k <= n; ++k) {
+        double spread = x - xi[n - k];
+        if (spread == 0.0)
+            throw std::invalid_argument("Duplicate X value in Newton interpolation");
+
+        row[k] = (row[k - 1] - diagonal[k - 1]) / spread;           // f[x_{n-k}, ..., x_n]
+    }
+
+    xi.push_back(x);
+    coeffs.push_back(row[n]);
+    diagonal = std::move(row);
+}
+
+// Evaluates the polynomial with nested Horner multiplication
+double NewtonInterpolant::evaluate(double x) const
+{
+    if (coeffs.empty())
+        return 0.0;
+
+    double result = coeffs.back();
+    for (size_t k = coeffs.size() - 1; k-- > 0;)
+        result = result * (x - xi[k]) + coeffs[k];
+
+    return result;
+}
+
+// Evaluates count x-values with the vectorized Horner kernel
+void NewtonInterpolant::evaluate(const double *x,
+                                 double *y,
+                                 size_t count) const
+{
+    Simd::evaluateNewton(xi.data(), coeffs.data(), coeffs.size(), x, y, count);
+}
+
+// First or second derivative at count x-values, differentiating the Horner recurrence alongside the value
+void NewtonInterpolant::derivative(const double *x,
+                                   double *dy,
+                                   size_t count,
+                                   int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    size_t n = coeffs.size();
+    for (size_t i = 0; i < count; ++i) {
+        double value = n > 0 ? coeffs[n - 1] : 0.0;
+        double slope = 0.0;
+        double curvature = 0.0;
+        for (size_t k = n > 0 ? n - 1 : 0; k-- > 0;) {
+            double s = x[i] - xi[k];
+            curvature = curvature * s + 2.0 * slope;
+            slope = slope * s + value;
+            value = value * s + coeffs[k];
+        }
+
+        dy[i] = order == 1 ? slope : curvature;
+    }
+}
+
+// Exact integral of the polynomial
+double NewtonInterpolant::integral(double a,
+                                   double b) const
+{
+    return ChebyshevInterpolant::integratePolynomial(*this, coeffs.size(), a, b);
+}
+
+// Nodes x_0, ..., x_{n-1}; only the first n - 1 enter the nested products, the last is kept for appending
+const std::vector<double> &NewtonInterpolant::centers() const
+{
+    return xi;
+}
+
+// Divided differences f[x_0], f[x_0, x_1], ..., f[x_0, ..., x_{n-1}]
+const std::vector<double> &NewtonInterpolant::coefficients() const
+{
+    return coeffs;
+}
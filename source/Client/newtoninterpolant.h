@@ -0,0 +1,34 @@
+#ifndef NEWTONINTERPOLANT_H
+#define NEWTONINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <vector>
+
+// Newton divided-difference form p(x) = c_0 + c_1 (x - x_0) + ... + c_{n-1} (x - x_0)...(x - x_{n-2}),
+// evaluated with nested Horner multiplication. Points can be appended in O(n), and the centers plus
+// coefficients fully describe the polynomial, so it can be saved and rebuilt without the original y-values.
+class NewtonInterpolant : public Interpolant
+{
+public:
+    NewtonInterpolant() = default;
+    NewtonInterpolant(const std::vector<double> &x, const std::vector<double> &y);
+    static NewtonInterpolant fromCoefficients(std::vector<double> centers, std::vector<double> coefficients);
+
+    void append(double x, double y);
+
+    double evaluate(double x) const override;
+    void evaluate(const double *x, double *y, size_t count) const override;
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+    double integral(double a, double b) const override;
+
+    const std::vector<double> &centers() const;
+    const std::vector<double> &coefficients() const;
+
+private:
+    std::vector<double> xi;         // Nodes in the order they were added
+    std::vector<double> coeffs;         // c_k = f[x_0, ..., x_k]
+    std::vector<double> diagonal;           // f[x_{n-1-k}, ..., x_{n-1}], the last table row needed to append
+};
+
+#endif //NEWTONINTERPOLANT_H
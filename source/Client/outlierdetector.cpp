@@ -0,0 +1,108 @@
+#include "outlierdetector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+// Tukey's fence multiplier for the interquartile range
+static const double FenceFactor = 1.5;
+
+// Modified z-score cut-off; 1.4826 MAD and 1.2533 mean absolute deviation estimate the standard deviation of normal data
+static const double ZScoreLimit = 3.5;
+static const double MadScale = 1.4826;
+static const double MeanDeviationScale = 1.2533;
+
+// Median by selection, reordering values; the lower middle of an even count is the largest of the lower half
+static double median(std::vector<double> &values)
+{
+    size_t half = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + half, values.end());
+    double upper = values[half];
+    if (values.size() % 2 != 0)
+        return upper;
+
+    double lower = *std::max_element(values.begin(), values.begin() + half);
+
+    return 0.5 * (lower + upper);
+}
+
+OutlierDetector::OutlierDetector(Rule rule)
+    : method(rule)
+{}
+
+void OutlierDetector::setRule(Rule rule)
+{
+    method = rule;
+}
+
+OutlierDetector::Rule OutlierDetector::rule() const
+{
+    return method;
+}
+
+// Range outside of which a value of data counts as an outlier under the current rule
+void OutlierDetector::bounds(const std::vector<double> &data,
+                             double &lower,
+                             double &upper) const
+{
+    lower = -std::numeric_limits<double>::infinity();
+    upper = std::numeric_limits<double>::infinity();
+    if (data.empty())
+        return;
+
+    std::vector<double> scratch = data;
+    size_t n = scratch.size();
+
+    if (method == Rule::IQR) {
+        // Same quartile positions as indexing the sorted data; the second selection only scans what lies above Q1
+        size_t first = n / 4, third = 3 * n / 4;
+        std::nth_element(scratch.begin(), scratch.begin() + first, scratch.end());
+        double q1 = scratch[first];
+        if (third > first)
+            std::nth_element(scratch.begin() + first + 1, scratch.begin() + third, scratch.end());
+        double q3 = scratch[third];
+        double iqr = q3 - q1;
+
+        lower = q1 - FenceFactor * iqr;
+        upper = q3 + FenceFactor * iqr;
+
+        return;
+    }
+
+    double center = median(scratch);
+    double meanDeviation = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        scratch[i] = std::fabs(data[i] - center);
+        meanDeviation += scratch[i];
+    }
+    meanDeviation /= n;
+
+    // More than half the values equal makes the MAD zero, in which case the mean absolute deviation stands in
+    double mad = median(scratch);
+    double spread = mad > 0.0 ? MadScale * mad : MeanDeviationScale * meanDeviation;
+
+    lower = center - ZScoreLimit * spread;
+    upper = center + ZScoreLimit * spread;
+}
+
+// Indices of the points whose x or y falls outside the bounds of its column, in ascending order
+std::vector<size_t> OutlierDetector::find(const std::vector<double> &x,
+                                          const std::vector<double> &y) const
+{
+    double x_lower, x_upper, y_lower, y_upper;
+    bounds(x, x_lower, x_upper);
+    bounds(y, y_lower, y_upper);
+
+    std::vector<size_t> outliers;
+    size_t n = std::min(x.size(), y.size());
+    for (size_t i = 0; i < n; ++i) {
+        bool x_out = x[i] < x_lower || x[i] > x_upper;
+        bool y_out = y[i] < y_lower || y[i] > y_upper;
+
+        if (x_out || y_out)
+            outliers.push_back(i);
+    }
+
+    return outliers;
+}
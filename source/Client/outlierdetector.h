@@ -0,0 +1,30 @@
+#ifndef OUTLIERDETECTOR_H
+#define OUTLIERDETECTOR_H
+
+#include <cstddef>
+#include <vector>
+
+// Flags points lying far from the bulk of the data, judged separately on x and on y.
+// The order statistics behind both rules are located with std::nth_element on a scratch copy,
+// expected O(n) per column instead of the O(n log n) of sorting it.
+class OutlierDetector
+{
+public:
+    enum class Rule {
+        IQR,            // Tukey fences, 1.5 interquartile ranges beyond the quartiles
+        MAD             // Modified z-score above 3.5 (Iglewicz and Hoaglin), robust against heavy tails
+    };
+
+    explicit OutlierDetector(Rule rule = Rule::IQR);
+
+    void setRule(Rule rule);
+    Rule rule() const;
+
+    void bounds(const std::vector<double> &data, double &lower, double &upper) const;
+    std::vector<size_t> find(const std::vector<double> &x, const std::vector<double> &y) const;
+
+private:
+    Rule method;
+};
+
+#endif //OUTLIERDETECTOR_H
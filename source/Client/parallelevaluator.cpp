@@ -0,0 +1,51 @@
+#include "parallelevaluator.h"
+
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentMap>
+
+#include <algorithm>
+
+
+ParallelEvaluator::ParallelEvaluator(size_t minChunkSize)
+    : minChunk(std::max<size_t>(1, minChunkSize))
+{}
+
+// Evaluates the interpolant at count x-values, spreading fixed-size chunks over all pool threads
+void ParallelEvaluator::evaluate(const Interpolant &interpolant,
+                                 const double *x,
+                                 double *y,
+                                 size_t count) const
+{
+    size_t threads = static_cast<size_t>(std::max(1, QThreadPool::globalInstance()->maxThreadCount()));
+
+    // Small grids are not worth the scheduling overhead
+    if (threads == 1 || count <= minChunk) {
+        interpolant.evaluate(x, y, count);
+
+        return;
+    }
+
+    // Aim for a few chunks per thread so uneven cores still balance, rounded to whole SIMD blocks
+    size_t chunk = std::max(minChunk, (count + threads * 4 - 1) / (threads * 4));
+    chunk = (chunk + 63) / 64 * 64;
+
+    std::vector<size_t> starts;
+    starts.reserve(count / chunk + 1);
+    for (size_t begin = 0; begin < count; begin += chunk)
+        starts.push_back(begin);
+
+    // Every chunk writes a disjoint slice of y, and the interpolant is only read
+    QtConcurrent::blockingMap(starts, [&](size_t begin) {
+        interpolant.evaluate(x + begin, y + begin, std::min(chunk, count - begin));
+    });
+}
+
+// Convenience overload returning a freshly allocated result vector
+std::vector<double> ParallelEvaluator::evaluate(const Interpolant &interpolant,
+                                                const std::vector<double> &x) const
+{
+    std::vector<double> y(x.size());
+    evaluate(interpolant, x.data(), y.data(), x.size());
+
+    return y;
+}
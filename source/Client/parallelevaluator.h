@@ -0,0 +1,24 @@
+#ifndef PARALLELEVALUATOR_H
+#define PARALLELEVALUATOR_H
+
+#include "interpolant.h"
+
+#include <cstddef>
+#include <vector>
+
+// Splits a batch evaluation into chunks and runs them on the global QThreadPool
+class ParallelEvaluator
+{
+public:
+    static constexpr size_t DefaultMinChunkSize = 2048;
+
+    explicit ParallelEvaluator(size_t minChunkSize = DefaultMinChunkSize);
+
+    void evaluate(const Interpolant &interpolant, const double *x, double *y, size_t count) const;
+    std::vector<double> evaluate(const Interpolant &interpolant, const std::vector<double> &x) const;
+
+private:
+    size_t minChunk;
+};
+
+#endif //PARALLELEVALUATOR_H
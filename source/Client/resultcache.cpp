@@ -0,0 +1,161 @@
+#include "resultcache.h"
+
+#include <cstring>
+#include <utility>
+
+
+// Finalizer of SplitMix64, spreads every input bit over the whole word
+static uint64_t mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+
+    return value;
+}
+
+bool ResultCache::Key::operator==(const Key &other) const
+{
+    return fingerprint == other.fingerprint && method == other.method && depth == other.depth;
+}
+
+size_t ResultCache::KeyHash::operator()(const Key &key) const
+{
+    return static_cast<size_t>(mix(key.fingerprint ^ mix((static_cast<uint64_t>(key.method) << 32) ^ static_cast<uint32_t>(key.depth))));
+}
+
+ResultCache::ResultCache(size_t capacityBytes)
+    : capacityBytes(capacityBytes)
+{}
+
+// Hashes the bit patterns of the sorted points in one pass; the point count is mixed in so prefixes differ
+uint64_t ResultCache::fingerprint(const std::vector<double> &sorted_x,
+                                  const std::vector<double> &sorted_y)
+{
+    uint64_t hash = mix(sorted_x.size() + 0x9e3779b97f4a7c15ULL);
+    for (size_t i = 0; i < sorted_x.size(); ++i) {
+        uint64_t xBits, yBits;
+        std::memcpy(&xBits, &sorted_x[i], sizeof(xBits));
+        std::memcpy(&yBits, &sorted_y[i], sizeof(yBits));
+        hash = mix(hash ^ xBits) + yBits;
+    }
+
+    return mix(hash);
+}
+
+// Returns the cached interpolant for key, or nullptr on a miss
+std::shared_ptr<const Interpolant> ResultCache::interpolant(const Key &key)
+{
+    Entry *entry = find(key);
+
+    return entry ? entry->interpolant : nullptr;
+}
+
+// Returns the cached evaluated grid for key, or nullptr on a miss
+std::shared_ptr<const Interpolator::InterpolatedData> ResultCache::data(const Key &key)
+{
+    Entry *entry = find(key);
+
+    return entry ? entry->data : nullptr;
+}
+
+// Caches an interpolant; its footprint is estimated from the point count (nodes, values and a third array)
+void ResultCache::insert(const Key &key,
+                         std::shared_ptr<const Interpolant> interpolant,
+                         size_t pointCount)
+{
+    store({key, std::move(interpolant), nullptr, sizeof(Entry) + 3 * pointCount * sizeof(double)});
+}
+
+// Caches an evaluated grid
+void ResultCache::insert(const Key &key,
+                         std::shared_ptr<const Interpolator::InterpolatedData> data)
+{
+    size_t bytes = sizeof(Entry) + (data->dense_x.capacity() + data->dense_y.capacity()) * sizeof(double);
+    store({key, nullptr, std::move(data), bytes});
+}
+
+// Changes the memory cap, evicting right away if the cache is now over it
+void ResultCache::setCapacity(size_t capacityBytes)
+{
+    this->capacityBytes = capacityBytes;
+    evict();
+}
+
+size_t ResultCache::capacity() const
+{
+    return capacityBytes;
+}
+
+// Number of cached entries
+size_t ResultCache::size() const
+{
+    return entries.size();
+}
+
+size_t ResultCache::hits() const
+{
+    return hitCount;
+}
+
+size_t ResultCache::misses() const
+{
+    return missCount;
+}
+
+// Drops every entry and resets the counters
+void ResultCache::clear()
+{
+    entries.clear();
+    index.clear();
+    usedBytes = 0;
+    hitCount = 0;
+    missCount = 0;
+}
+
+// Looks the key up, counting the hit or miss and marking a hit as most recently used
+ResultCache::Entry *ResultCache::find(const Key &key)
+{
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++missCount;
+
+        return nullptr;
+    }
+
+    ++hitCount;
+    entries.splice(entries.begin(), entries, it->second);
+
+    return &entries.front();
+}
+
+// Inserts or replaces an entry; anything larger than the whole cap is not kept at all
+void ResultCache::store(Entry entry)
+{
+    auto it = index.find(entry.key);
+    if (it != index.end()) {
+        usedBytes -= it->second->bytes;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+
+    if (entry.bytes > capacityBytes)
+        return;
+
+    usedBytes += entry.bytes;
+    entries.push_front(std::move(entry));
+    index[entries.front().key] = entries.begin();
+    evict();
+}
+
+// Removes least recently used entries until the footprint fits the cap
+void ResultCache::evict()
+{
+    while (usedBytes > capacityBytes && !entries.empty()) {
+        usedBytes -= entries.back().bytes;
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
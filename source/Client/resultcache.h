@@ -0,0 +1,74 @@
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include "interpolant.h"
+#include "interpolator.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Least-recently-used cache of interpolants and evaluated grids.
+// Entries are keyed by a 64-bit fingerprint of the sorted points together with the method and depth;
+// once the estimated footprint passes the memory cap, the oldest entries are evicted first.
+class ResultCache
+{
+public:
+    static constexpr size_t DefaultCapacity = size_t(64) << 20;         // 64 MiB
+    static constexpr int InterpolantDepth = -1;         // Depth used in keys of interpolant entries
+    static constexpr int AdaptiveDepth = -2;            // Depth used in keys of adaptive sampler results, lowered by their seed depth
+
+    struct Key
+    {
+        uint64_t fingerprint;
+        int method;
+        int depth;
+
+        bool operator==(const Key &other) const;
+    };
+
+    explicit ResultCache(size_t capacityBytes = DefaultCapacity);
+
+    static uint64_t fingerprint(const std::vector<double> &sorted_x, const std::vector<double> &sorted_y);
+
+    std::shared_ptr<const Interpolant> interpolant(const Key &key);
+    std::shared_ptr<const Interpolator::InterpolatedData> data(const Key &key);
+    void insert(const Key &key, std::shared_ptr<const Interpolant> interpolant, size_t pointCount);
+    void insert(const Key &key, std::shared_ptr<const Interpolator::InterpolatedData> data);
+
+    void setCapacity(size_t capacityBytes);
+    size_t capacity() const;
+    size_t size() const;
+    size_t hits() const;
+    size_t misses() const;
+    void clear();
+
+private:
+    struct Entry
+    {
+        Key key;
+        std::shared_ptr<const Interpolant> interpolant;
+        std::shared_ptr<const Interpolator::InterpolatedData> data;
+        size_t bytes;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const;
+    };
+
+    std::list<Entry> entries;           // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    size_t capacityBytes;
+    size_t usedBytes = 0;
+    size_t hitCount = 0;
+    size_t missCount = 0;
+
+    Entry *find(const Key &key);
+    void store(Entry entry);
+    void evict();
+};
+
+#endif //RESULTCACHE_H
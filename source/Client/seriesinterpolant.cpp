@@ -0,0 +1,97 @@
+#include "seriesinterpolant.h"
+#include "simdkernels.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+
+// Basis block sized so the n x block matrix stays around 256 KiB, in cache while every series reads it
+static const size_t BasisBytes = size_t(256) << 10;
+
+// Shared-basis form for the global interpolating polynomial through sorted_x
+SeriesInterpolant::SeriesInterpolant(std::vector<double> sorted_x,
+                                     std::vector<std::vector<double>> columns)
+    : xi(std::move(sorted_x))
+    , wi(BarycentricInterpolant::computeWeights(xi))
+    , yi(std::move(columns))
+{
+    for (const std::vector<double> &column : yi)
+        if (column.size() != xi.size())
+            throw std::invalid_argument("Incomplete point input");
+}
+
+// Independent form, one prebuilt interpolant per series
+SeriesInterpolant::SeriesInterpolant(std::vector<std::shared_ptr<const Interpolant>> interpolants)
+    : perSeries(std::move(interpolants))
+{}
+
+size_t SeriesInterpolant::seriesCount() const
+{
+    return perSeries.empty() ? yi.size() : perSeries.size();
+}
+
+// Evaluates every series at count x-values, y[s][i] being series s at x[i]
+void SeriesInterpolant::evaluate(const double *x,
+                                 size_t count,
+                                 std::vector<std::vector<double>> &y) const
+{
+    y.resize(seriesCount());
+    for (std::vector<double> &column : y)
+        column.resize(count);
+
+    if (!perSeries.empty()) {
+        for (size_t s = 0; s < perSeries.size(); ++s)
+            perSeries[s]->evaluate(x, y[s].data(), count);
+
+        return;
+    }
+
+    size_t n = xi.size();
+    size_t block = std::max<size_t>(64, BasisBytes / (sizeof(double) * std::max<size_t>(n, 1)));
+    std::vector<double> rows(n * std::min(block, count));
+    std::vector<double> sums(std::min(block, count));
+
+    // Basis values for a block of x once, then one SIMD row combination per series
+    for (size_t start = 0; start < count; start += block) {
+        size_t size = std::min(block, count - start);
+        basis(x + start, size, rows.data(), sums.data());
+        for (size_t s = 0; s < yi.size(); ++s)
+            Simd::combineRows(rows.data(), n, size, yi[s].data(), y[s].data() + start, size);
+    }
+}
+
+// Fills rows[j * count + i] with l_j(x[i]) = (w_j / (x_i - x_j)) / sum_k (w_k / (x_i - x_k)),
+// node-major so the inner loops run over contiguous x and vectorize; sums holds count scratch values
+void SeriesInterpolant::basis(const double *x,
+                              size_t count,
+                              double *rows,
+                              double *sums) const
+{
+    size_t n = xi.size();
+    std::fill(sums, sums + count, 0.0);
+    for (size_t j = 0; j < n; ++j) {
+        double *row = rows + j * count;
+        for (size_t i = 0; i < count; ++i) {
+            row[i] = wi[j] / (x[i] - xi[j]);
+            sums[i] += row[i];
+        }
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+        double *row = rows + j * count;
+        for (size_t i = 0; i < count; ++i)
+            row[i] /= sums[i];
+    }
+
+    // An x exactly on a node gave an infinite term; its basis is the unit vector of that node
+    for (size_t i = 0; i < count; ++i) {
+        auto node = std::lower_bound(xi.begin(), xi.end(), x[i]);
+        if (node == xi.end() || *node != x[i])
+            continue;
+
+        for (size_t j = 0; j < n; ++j)
+            rows[j * count + i] = 0.0;
+        rows[(node - xi.begin()) * count + i] = 1.0;
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef SERIESINTERPOLANT_H
+#define SERIESINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <memory>
+#include <vector>
+
+// Several y-series interpolated over one shared set of x-values.
+// For the global polynomial the Lagrange basis l_j(x) does not depend on y, so it is computed once per
+// evaluated x and applied to every series as a small matrix product; other methods keep one interpolant per series.
+class SeriesInterpolant
+{
+public:
+    SeriesInterpolant(std::vector<double> sorted_x, std::vector<std::vector<double>> columns);
+    explicit SeriesInterpolant(std::vector<std::shared_ptr<const Interpolant>> interpolants);
+
+    size_t seriesCount() const;
+    void evaluate(const double *x, size_t count, std::vector<std::vector<double>> &y) const;
+
+private:
+    std::vector<double> xi, wi;
+    std::vector<std::vector<double>> yi;            // One sorted y column per series
+    std::vector<std::shared_ptr<const Interpolant>> perSeries;          // Used instead of the shared basis when set
+
+    void basis(const double *x, size_t count, double *rows, double *sums) const;
+};
+
+#endif //SERIESINTERPOLANT_H
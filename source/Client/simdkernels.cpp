@@ -0,0 +1,531 @@
+#include "simdkernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Vector tiers rely on GCC vector extensions and per-region target options (MinGW and Linux g++)
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86 1
+#endif
+
+
+// Scalar barycentric evaluation, also used by the vector tiers for tails and exact node hits
+template <typename T>
+static T barycentricScalar(const T *nodes,
+                           const T *values,
+                           const T *weights,
+                           size_t n,
+                           T x)
+{
+    T numerator = 0;
+    T denominator = 0;
+
+    for (size_t j = 0; j < n; ++j) {
+        T diff = x - nodes[j];
+        if (diff == 0)
+            return values[j];
+
+        T term = weights[j] / diff;
+        numerator += term * values[j];
+        denominator += term;
+    }
+
+    return numerator / denominator;
+}
+
+// Scalar Horner evaluation of the Newton form
+static double newtonScalar(const double *centers,
+                           const double *coefficients,
+                           size_t n,
+                           double x)
+{
+    if (n == 0)
+        return 0.0;
+
+    double result = coefficients[n - 1];
+    for (size_t k = n - 1; k-- > 0;)
+        result = result * (x - centers[k]) + coefficients[k];
+
+    return result;
+}
+
+// Scalar Clenshaw recurrence for a Chebyshev series on [a, b]
+static double chebyshevScalar(const double *coefficients,
+                              size_t n,
+                              double a,
+                              double b,
+                              double x)
+{
+    if (n == 0)
+        return 0.0;
+
+    double t = (2.0 * x - (a + b)) / (b - a);
+    double next = 0.0;
+    double afterNext = 0.0;
+    for (size_t k = n; k-- > 1;) {
+        double current = coefficients[k] + 2.0 * t * next - afterNext;
+        afterNext = next;
+        next = current;
+    }
+
+    return coefficients[0] + t * next - afterNext;
+}
+
+// Scalar weighted sum down one column of a row-major matrix
+static double combineScalar(const double *rows,
+                            size_t n,
+                            size_t stride,
+                            const double *coefficients,
+                            size_t column)
+{
+    double sum = 0.0;
+    for (size_t j = 0; j < n; ++j)
+        sum += coefficients[j] * rows[j * stride + column];
+
+    return sum;
+}
+
+// Scalar first and second derivative of the barycentric interpolant (either output may be null), after Schneider and Werner.
+// With k the nearest node, the values are shifted by y_k so the divided differences
+// r_j = (p - y_j) / (x - x_j) and s_j = (p' - r_j) / (x - x_j) never subtract nearly equal numbers,
+// which keeps both derivatives accurate arbitrarily close to a node. On a node x_k it switches to
+// the differentiation matrix formulas.
+static void barycentricDerivativesScalar(const double *nodes,
+                                         const double *values,
+                                         const double *weights,
+                                         size_t n,
+                                         double x,
+                                         double *first,
+                                         double *second)
+{
+    if (n == 0) {
+        if (first)
+            *first = 0.0;
+        if (second)
+            *second = 0.0;
+
+        return;
+    }
+
+    size_t k = 0;
+    for (size_t j = 1; j < n; ++j)
+        if (std::fabs(x - nodes[j]) < std::fabs(x - nodes[k]))
+            k = j;
+
+    double slope = 0.0;
+    double curvature = 0.0;
+    if (x == nodes[k]) {
+        // D_kj = (w_j / w_k) / (x_k - x_j), D_kk = -sum D_kj, D2_kj = 2 D_kj (D_kk - 1 / (x_k - x_j))
+        double diagonal = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            if (j == k)
+                continue;
+
+            double d = weights[j] / (weights[k] * (nodes[k] - nodes[j]));
+            diagonal -= d;
+            slope += d * (values[j] - values[k]);
+        }
+
+        for (size_t j = 0; second && j < n; ++j) {
+            if (j == k)
+                continue;
+
+            double inverse = 1.0 / (nodes[k] - nodes[j]);
+            double d = weights[j] / weights[k] * inverse;
+            curvature += 2.0 * d * (diagonal - inverse) * (values[j] - values[k]);
+        }
+    } else {
+        // p - y_k = sum_{j != k} w_j t_j (y_j - y_k) / sum w_j t_j, with t_j = 1 / (x - x_j)
+        double denominator = 0.0;
+        double shifted = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            double term = weights[j] / (x - nodes[j]);
+            denominator += term;
+            if (j != k)
+                shifted += term * (values[j] - values[k]);
+        }
+        double offset = shifted / denominator;          // p - y_k
+        double nearest = offset / (x - nodes[k]);           // r_k
+
+        // p' - r_k = sum_{j != k} w_j t_j (r_j - r_k) / sum w_j t_j
+        double excess = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            if (j == k)
+                continue;
+
+            double t = 1.0 / (x - nodes[j]);
+            double r = (offset - (values[j] - values[k])) * t;
+            excess += weights[j] * t * (r - nearest);
+        }
+        excess /= denominator;
+        slope = nearest + excess;
+
+        // p'' = 2 sum w_j t_j s_j / sum w_j t_j, where s_k = (p' - r_k) t_k comes straight from the excess
+        for (size_t j = 0; second && j < n; ++j) {
+            double t = 1.0 / (x - nodes[j]);
+            double s = j == k ? excess * t : (slope - (offset - (values[j] - values[k])) * t) * t;
+            curvature += weights[j] * t * s;
+        }
+        curvature = 2.0 * curvature / denominator;
+    }
+
+    if (first)
+        *first = slope;
+    if (second)
+        *second = curvature;
+}
+
+// Error-free transformations for double-double arithmetic: hi + lo holds the exact result
+static inline void twoSum(double a,
+                          double b,
+                          double &hi,
+                          double &lo)
+{
+    hi = a + b;
+    double bb = hi - a;
+    lo = (a - (hi - bb)) + (b - bb);
+}
+
+static inline void twoProduct(double a,
+                              double b,
+                              double &hi,
+                              double &lo)
+{
+    hi = a * b;
+    lo = std::fma(a, b, -hi);
+}
+
+// Adds the double-double (bHi, bLo) to the accumulator (hi, lo)
+static inline void addTo(double &hi,
+                         double &lo,
+                         double bHi,
+                         double bLo)
+{
+    double s, e;
+    twoSum(hi, bHi, s, e);
+    e += lo + bLo;
+    hi = s + e;
+    lo = e - (hi - s);
+}
+
+// Barycentric evaluation in double-double arithmetic.
+// The differences, quotients and both sums keep their rounding errors as a low word, which
+// recovers roughly 30 extra bits where cancellation in the sums would otherwise eat the result.
+static double barycentricCompensated(const double *nodes,
+                                     const double *values,
+                                     const double *weights,
+                                     size_t n,
+                                     double x)
+{
+    double numeratorHi = 0.0, numeratorLo = 0.0;
+    double denominatorHi = 0.0, denominatorLo = 0.0;
+
+    for (size_t j = 0; j < n; ++j) {
+        double diffHi, diffLo;
+        twoSum(x, -nodes[j], diffHi, diffLo);
+        if (diffHi == 0.0)
+            return values[j];
+
+        // term = w / diff, refined by one Newton step on the remainder
+        double termHi = weights[j] / diffHi;
+        double remainder = std::fma(-termHi, diffHi, weights[j]) - termHi * diffLo;
+        double termLo = remainder / diffHi;
+
+        double productHi, productLo;
+        twoProduct(termHi, values[j], productHi, productLo);
+        productLo += termLo * values[j];
+
+        addTo(numeratorHi, numeratorLo, productHi, productLo);
+        addTo(denominatorHi, denominatorLo, termHi, termLo);
+    }
+
+    // Double-double division, rounded once to double
+    double quotient = numeratorHi / denominatorHi;
+    double productHi, productLo;
+    twoProduct(quotient, denominatorHi, productHi, productLo);
+    double correction = ((numeratorHi - productHi) - productLo + numeratorLo - quotient * denominatorLo) / denominatorHi;
+
+    return quotient + correction;
+}
+
+#ifdef SIMD_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#define SIMD_NAMESPACE Sse2Kernels
+#define SIMD_BYTES 16
+#include "simdkernels.inc"
+#undef SIMD_BYTES
+#undef SIMD_NAMESPACE
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#define SIMD_NAMESPACE Avx2Kernels
+#define SIMD_BYTES 32
+#include "simdkernels.inc"
+#undef SIMD_BYTES
+#undef SIMD_NAMESPACE
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define SIMD_NAMESPACE Avx512Kernels
+#define SIMD_BYTES 64
+#include "simdkernels.inc"
+#undef SIMD_BYTES
+#undef SIMD_NAMESPACE
+#pragma GCC pop_options
+
+#endif
+
+// Queries the CPU once for the best supported tier
+Simd::Level Simd::detectedLevel()
+{
+    static const Level level = [] {
+#ifdef SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return Level::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return Level::AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return Level::SSE2;
+#endif
+        return Level::Scalar;
+    }();
+
+    return level;
+}
+
+static std::atomic<int> &activeLevelStorage()
+{
+    static std::atomic<int> level(static_cast<int>(Simd::detectedLevel()));
+
+    return level;
+}
+
+// Returns the tier currently used by the batch kernels
+Simd::Level Simd::activeLevel()
+{
+    return static_cast<Level>(activeLevelStorage().load(std::memory_order_relaxed));
+}
+
+// Forces a tier (e.g. to compare results), clamped to what the CPU supports
+void Simd::setActiveLevel(Level level)
+{
+    if (static_cast<int>(level) > static_cast<int>(detectedLevel()))
+        level = detectedLevel();
+
+    activeLevelStorage().store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+// Human-readable tier name
+const char *Simd::levelName(Level level)
+{
+    switch (level) {
+    case Level::SSE2:
+        return "SSE2";
+    case Level::AVX2:
+        return "AVX2";
+    case Level::AVX512:
+        return "AVX-512";
+    default:
+        return "Scalar";
+    }
+}
+
+// Evaluates the barycentric interpolant at count x-values using the active tier
+void Simd::evaluateBarycentric(const double *nodes,
+                               const double *values,
+                               const double *weights,
+                               size_t n,
+                               const double *x,
+                               double *y,
+                               size_t count)
+{
+    switch (activeLevel()) {
+#ifdef SIMD_X86
+    case Level::AVX512:
+        Avx512Kernels::evaluateBarycentric(nodes, values, weights, n, x, y, count);
+        return;
+    case Level::AVX2:
+        Avx2Kernels::evaluateBarycentric(nodes, values, weights, n, x, y, count);
+        return;
+    case Level::SSE2:
+        Sse2Kernels::evaluateBarycentric(nodes, values, weights, n, x, y, count);
+        return;
+#endif
+    default:
+        for (size_t i = 0; i < count; ++i)
+            y[i] = barycentricScalar(nodes, values, weights, n, x[i]);
+    }
+}
+
+// Evaluates the first and/or second derivative of the barycentric interpolant at count x-values
+void Simd::evaluateBarycentricDerivatives(const double *nodes,
+                                          const double *values,
+                                          const double *weights,
+                                          size_t n,
+                                          const double *x,
+                                          double *first,
+                                          double *second,
+                                          size_t count)
+{
+    switch (activeLevel()) {
+#ifdef SIMD_X86
+    case Level::AVX512:
+        Avx512Kernels::evaluateBarycentricDerivatives(nodes, values, weights, n, x, first, second, count);
+        return;
+    case Level::AVX2:
+        Avx2Kernels::evaluateBarycentricDerivatives(nodes, values, weights, n, x, first, second, count);
+        return;
+    case Level::SSE2:
+        Sse2Kernels::evaluateBarycentricDerivatives(nodes, values, weights, n, x, first, second, count);
+        return;
+#endif
+    default:
+        for (size_t i = 0; i < count; ++i)
+            barycentricDerivativesScalar(nodes, values, weights, n, x[i], first ? first + i : nullptr, second ? second + i : nullptr);
+    }
+}
+
+// Linear combination of n rows of length count (spaced stride apart) using the active tier
+void Simd::combineRows(const double *rows,
+                       size_t n,
+                       size_t stride,
+                       const double *coefficients,
+                       double *out,
+                       size_t count)
+{
+    switch (activeLevel()) {
+#ifdef SIMD_X86
+    case Level::AVX512:
+        Avx512Kernels::combineRows(rows, n, stride, coefficients, out, count);
+        return;
+    case Level::AVX2:
+        Avx2Kernels::combineRows(rows, n, stride, coefficients, out, count);
+        return;
+    case Level::SSE2:
+        Sse2Kernels::combineRows(rows, n, stride, coefficients, out, count);
+        return;
+#endif
+    default:
+        for (size_t r = 0; r < count; ++r)
+            out[r] = combineScalar(rows, n, stride, coefficients, r);
+    }
+}
+
+// Single precision tier: float nodes, values and weights with double input and output.
+// The nodes are given mapped by (x - center) * scale, usually onto [-1, 1], and the x-values are mapped the same way
+// while they are narrowed in small stack blocks. Differences of order one keep eight of them in a float product
+// in range however wide the data is, and the kernel runs at twice the lane count without allocating.
+void Simd::evaluateBarycentric(const float *nodes,
+                               const float *values,
+                               const float *weights,
+                               size_t n,
+                               double center,
+                               double scale,
+                               const double *x,
+                               double *y,
+                               size_t count)
+{
+    constexpr size_t Block = 512;
+    float xf[Block];
+    float yf[Block];
+
+    for (size_t start = 0; start < count; start += Block) {
+        size_t size = count - start < Block ? count - start : Block;
+        for (size_t i = 0; i < size; ++i)
+            xf[i] = static_cast<float>((x[start + i] - center) * scale);
+
+        switch (activeLevel()) {
+#ifdef SIMD_X86
+        case Level::AVX512:
+            Avx512Kernels::evaluateBarycentric(nodes, values, weights, n, xf, yf, size);
+            break;
+        case Level::AVX2:
+            Avx2Kernels::evaluateBarycentric(nodes, values, weights, n, xf, yf, size);
+            break;
+        case Level::SSE2:
+            Sse2Kernels::evaluateBarycentric(nodes, values, weights, n, xf, yf, size);
+            break;
+#endif
+        default:
+            for (size_t i = 0; i < size; ++i)
+                yf[i] = barycentricScalar(nodes, values, weights, n, xf[i]);
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            y[start + i] = yf[i];
+    }
+}
+
+// Compensated tier, scalar double-double evaluation for ill-conditioned data
+void Simd::evaluateBarycentricCompensated(const double *nodes,
+                                          const double *values,
+                                          const double *weights,
+                                          size_t n,
+                                          const double *x,
+                                          double *y,
+                                          size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        y[i] = barycentricCompensated(nodes, values, weights, n, x[i]);
+}
+
+// Evaluates the Newton form at count x-values using the active tier
+void Simd::evaluateNewton(const double *centers,
+                          const double *coefficients,
+                          size_t n,
+                          const double *x,
+                          double *y,
+                          size_t count)
+{
+    switch (activeLevel()) {
+#ifdef SIMD_X86
+    case Level::AVX512:
+        Avx512Kernels::evaluateNewton(centers, coefficients, n, x, y, count);
+        return;
+    case Level::AVX2:
+        Avx2Kernels::evaluateNewton(centers, coefficients, n, x, y, count);
+        return;
+    case Level::SSE2:
+        Sse2Kernels::evaluateNewton(centers, coefficients, n, x, y, count);
+        return;
+#endif
+    default:
+        for (size_t i = 0; i < count; ++i)
+            y[i] = newtonScalar(centers, coefficients, n, x[i]);
+    }
+}
+
+// Evaluates a Chebyshev series at count x-values using the active tier
+void Simd::evaluateChebyshev(const double *coefficients,
+                             size_t n,
+                             double a,
+                             double b,
+                             const double *x,
+                             double *y,
+                             size_t count)
+{
+    switch (activeLevel()) {
+#ifdef SIMD_X86
+    case Level::AVX512:
+        Avx512Kernels::evaluateChebyshev(coefficients, n, a, b, x, y, count);
+        return;
+    case Level::AVX2:
+        Avx2Kernels::evaluateChebyshev(coefficients, n, a, b, x, y, count);
+        return;
+    case Level::SSE2:
+        Sse2Kernels::evaluateChebyshev(coefficients, n, a, b, x, y, count);
+        return;
+#endif
+    default:
+        for (size_t i = 0; i < count; ++i)
+            y[i] = chebyshevScalar(coefficients, n, a, b, x[i]);
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+#include <cstddef>
+
+// Vectorized batch kernels with runtime CPU dispatch
+namespace Simd
+{
+    // Instruction set tiers, ordered from slowest to fastest
+    enum class Level
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    Level detectedLevel();
+    Level activeLevel();
+    void setActiveLevel(Level level);
+    const char *levelName(Level level);
+
+    void evaluateBarycentric(const double *nodes, const double *values, const double *weights, size_t n,
+                             const double *x, double *y, size_t count);
+    void evaluateBarycentric(const float *nodes, const float *values, const float *weights, size_t n,
+                             double center, double scale, const double *x, double *y, size_t count);
+    void evaluateBarycentricCompensated(const double *nodes, const double *values, const double *weights, size_t n,
+                                        const double *x, double *y, size_t count);
+    void evaluateBarycentricDerivatives(const double *nodes, const double *values, const double *weights, size_t n,
+                                        const double *x, double *first, double *second, size_t count);
+    void combineRows(const double *rows, size_t n, size_t stride, const double *coefficients,
+                     double *out, size_t count);
+    void evaluateNewton(const double *centers, const double *coefficients, size_t n,
+                        const double *x, double *y, size_t count);
+    void evaluateChebyshev(const double *coefficients, size_t n, double a, double b,
+                           const double *x, double *y, size_t count);
+}
+
+#endif //SIMDKERNELS_H
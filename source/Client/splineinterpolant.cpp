@@ -0,0 +1,268 @@
+#include "splineinterpolant.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+
+//                      PIECEWISE CUBIC                       //
+
+PiecewiseCubicInterpolant::PiecewiseCubicInterpolant(std::vector<double> x,
+                                                     std::vector<double> y)
+    : xi(std::move(x))
+    , yi(std::move(y))
+{
+    if (xi.size() != yi.size())
+        throw std::invalid_argument("Incomplete point input");
+    if (xi.size() < 2)
+        throw std::invalid_argument("Spline interpolation needs at least two points");
+}
+
+// Stores the node slopes and derives the per-interval polynomial coefficients
+void PiecewiseCubicInterpolant::setSlopes(std::vector<double> slopes)
+{
+    di = std::move(slopes);
+
+    size_t intervals = xi.size() - 1;
+    ci.resize(intervals);
+    ei.resize(intervals);
+    for (size_t i = 0; i < intervals; ++i) {
+        double h = xi[i + 1] - xi[i];
+        double secant = (yi[i + 1] - yi[i]) / h;
+        ci[i] = (3.0 * secant - 2.0 * di[i] - di[i + 1]) / h;
+        ei[i] = (di[i] + di[i + 1] - 2.0 * secant) / (h * h);
+    }
+
+    // Running integral over whole intervals, so a definite integral costs two lookups
+    areas.assign(xi.size(), 0.0);
+    for (size_t i = 0; i < intervals; ++i) {
+        double h = xi[i + 1] - xi[i];
+        areas[i + 1] = areas[i] + h * (yi[i] + h * (di[i] / 2.0 + h * (ci[i] / 3.0 + h * ei[i] / 4.0)));
+    }
+}
+
+// Evaluates a single x after a binary search for its interval
+double PiecewiseCubicInterpolant::evaluate(double x) const
+{
+    return evaluateInterval(interval(x), x);
+}
+
+// Evaluates count x-values; ascending runs move the interval cursor forward instead of searching
+void PiecewiseCubicInterpolant::evaluate(const double *x,
+                                         double *y,
+                                         size_t count) const
+{
+    size_t last = xi.size() - 2;
+    size_t current = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i == 0 || x[i] < x[i - 1]) {
+            current = interval(x[i]);
+        } else {
+            while (current < last && xi[current + 1] <= x[i])
+                ++current;
+        }
+
+        y[i] = evaluateInterval(current, x[i]);
+    }
+}
+
+// First or second derivative of the cubic pieces at count x-values, with the same interval cursor as evaluate
+void PiecewiseCubicInterpolant::derivative(const double *x,
+                                           double *dy,
+                                           size_t count,
+                                           int order) const
+{
+    if (order != 1 && order != 2)
+        throw std::invalid_argument("Only first and second derivatives are supported");
+
+    size_t last = xi.size() - 2;
+    size_t current = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i == 0 || x[i] < x[i - 1]) {
+            current = interval(x[i]);
+        } else {
+            while (current < last && xi[current + 1] <= x[i])
+                ++current;
+        }
+
+        double s = x[i] - xi[current];
+        if (order == 1)
+            dy[i] = di[current] + s * (2.0 * ci[current] + 3.0 * s * ei[current]);
+        else
+            dy[i] = 2.0 * ci[current] + 6.0 * s * ei[current];
+    }
+}
+
+// Exact definite integral of the piecewise cubic
+double PiecewiseCubicInterpolant::integral(double a,
+                                           double b) const
+{
+    return antiderivative(b) - antiderivative(a);
+}
+
+const std::vector<double> &PiecewiseCubicInterpolant::nodes() const
+{
+    return xi;
+}
+
+const std::vector<double> &PiecewiseCubicInterpolant::slopes() const
+{
+    return di;
+}
+
+// Index i of the interval [x_i, x_{i+1}] holding x, outside values use the end intervals
+size_t PiecewiseCubicInterpolant::interval(double x) const
+{
+    size_t upper = std::upper_bound(xi.begin(), xi.end(), x) - xi.begin();
+
+    return std::min(upper > 0 ? upper - 1 : 0, xi.size() - 2);
+}
+
+// Cubic of interval i in nested form around its left node
+double PiecewiseCubicInterpolant::evaluateInterval(size_t i,
+                                                   double x) const
+{
+    double s = x - xi[i];
+
+    return yi[i] + s * (di[i] + s * (ci[i] + s * ei[i]));
+}
+
+// Integral from x_0 to x, the end pieces extended outside the nodes like evaluate does
+double PiecewiseCubicInterpolant::antiderivative(double x) const
+{
+    size_t i = interval(x);
+    double s = x - xi[i];
+
+    return areas[i] + s * (yi[i] + s * (di[i] / 2.0 + s * (ci[i] / 3.0 + s * ei[i] / 4.0)));
+}
+
+// Slopes of the straight lines between consecutive nodes
+std::vector<double> PiecewiseCubicInterpolant::secants(const std::vector<double> &x,
+                                                       const std::vector<double> &y)
+{
+    std::vector<double> result(x.size() - 1);
+    for (size_t i = 0; i + 1 < x.size(); ++i)
+        result[i] = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+
+    return result;
+}
+
+//                      CUBIC SPLINE                       //
+
+CubicSplineInterpolant::CubicSplineInterpolant(std::vector<double> x,
+                                               std::vector<double> y,
+                                               Boundary boundary,
+                                               double startSlope,
+                                               double endSlope)
+    : PiecewiseCubicInterpolant(std::move(x), std::move(y))
+{
+    size_t n = xi.size();
+    std::vector<double> delta = secants(xi, yi);
+
+    // Tridiagonal system for the slopes: sub[i] d_{i-1} + diag[i] d_i + super[i] d_{i+1} = rhs[i]
+    std::vector<double> sub(n, 0.0), diag(n, 1.0), super(n, 0.0), rhs(n, 0.0);
+    for (size_t i = 1; i + 1 < n; ++i) {
+        double left = xi[i] - xi[i - 1];
+        double right = xi[i + 1] - xi[i];
+        sub[i] = right;
+        diag[i] = 2.0 * (left + right);
+        super[i] = left;
+        rhs[i] = 3.0 * (right * delta[i - 1] + left * delta[i]);
+    }
+
+    if (boundary == Boundary::Clamped) {
+        rhs[0] = startSlope;
+        rhs[n - 1] = endSlope;
+    } else {
+        // Natural ends: 2 d_0 + d_1 = 3 delta_0 and d_{n-2} + 2 d_{n-1} = 3 delta_{n-2}
+        diag[0] = 2.0;
+        super[0] = 1.0;
+        rhs[0] = 3.0 * delta[0];
+        sub[n - 1] = 1.0;
+        diag[n - 1] = 2.0;
+        rhs[n - 1] = 3.0 * delta[n - 2];
+    }
+
+    // Thomas algorithm, forward elimination then back substitution
+    for (size_t i = 1; i < n; ++i) {
+        double factor = sub[i] / diag[i - 1];
+        diag[i] -= factor * super[i - 1];
+        rhs[i] -= factor * rhs[i - 1];
+    }
+
+    std::vector<double> slopes(n);
+    slopes[n - 1] = rhs[n - 1] / diag[n - 1];
+    for (size_t i = n - 1; i-- > 0;)
+        slopes[i] = (rhs[i] - super[i] * slopes[i + 1]) / diag[i];
+
+    setSlopes(std::move(slopes));
+}
+
+// Derivative at the first node of the parabola through the first three points
+double CubicSplineInterpolant::estimateStartSlope(const std::vector<double> &x,
+                                                  const std::vector<double> &y)
+{
+    if (x.size() < 3)
+        return (y[1] - y[0]) / (x[1] - x[0]);
+
+    double h0 = x[1] - x[0];
+    double h1 = x[2] - x[1];
+    double d0 = (y[1] - y[0]) / h0;
+    double d1 = (y[2] - y[1]) / h1;
+
+    return ((2.0 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+}
+
+// Derivative at the last node of the parabola through the last three points
+double CubicSplineInterpolant::estimateEndSlope(const std::vector<double> &x,
+                                                const std::vector<double> &y)
+{
+    size_t n = x.size();
+    if (n < 3)
+        return (y[n - 1] - y[n - 2]) / (x[n - 1] - x[n - 2]);
+
+    double h0 = x[n - 1] - x[n - 2];
+    double h1 = x[n - 2] - x[n - 3];
+    double d0 = (y[n - 1] - y[n - 2]) / h0;
+    double d1 = (y[n - 2] - y[n - 3]) / h1;
+
+    return ((2.0 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+}
+
+//                      AKIMA                       //
+
+AkimaInterpolant::AkimaInterpolant(std::vector<double> x,
+                                   std::vector<double> y)
+    : PiecewiseCubicInterpolant(std::move(x), std::move(y))
+{
+    size_t n = xi.size();
+    std::vector<double> delta = secants(xi, yi);
+    if (n == 2) {
+        setSlopes({delta[0], delta[0]});
+
+        return;
+    }
+
+    // Secants padded with two linearly extrapolated values on each side, m[i + 2] = delta_i
+    std::vector<double> m(n + 3);
+    std::copy(delta.begin(), delta.end(), m.begin() + 2);
+    m[1] = 2.0 * m[2] - m[3];
+    m[0] = 2.0 * m[1] - m[2];
+    m[n + 1] = 2.0 * m[n] - m[n - 1];
+    m[n + 2] = 2.0 * m[n + 1] - m[n];
+
+    std::vector<double> slopes(n);
+    for (size_t i = 0; i < n; ++i) {
+        double rightWeight = std::fabs(m[i + 3] - m[i + 2]);
+        double leftWeight = std::fabs(m[i + 1] - m[i]);
+        double total = rightWeight + leftWeight;
+
+        // Equal neighbouring secants leave the weights undefined, fall back to their average
+        slopes[i] = total > 0.0 ? (rightWeight * m[i + 1] + leftWeight * m[i + 2]) / total : 0.5 * (m[i + 1] + m[i + 2]);
+    }
+
+    setSlopes(std::move(slopes));
+}
@@ -0,0 +1,61 @@
+#ifndef SPLINEINTERPOLANT_H
+#define SPLINEINTERPOLANT_H
+
+#include "interpolant.h"
+
+#include <vector>
+
+// Piecewise cubic given by values and slopes at the nodes (Hermite form).
+// Evaluation looks up the interval (binary search, or a forward cursor for ascending batches),
+// so building and evaluating a whole grid is linear in the number of points plus samples.
+class PiecewiseCubicInterpolant : public Interpolant
+{
+public:
+    double evaluate(double x) const override;
+    void evaluate(const double *x, double *y, size_t count) const override;
+    void derivative(const double *x, double *dy, size_t count, int order = 1) const override;
+    double integral(double a, double b) const override;
+
+    const std::vector<double> &nodes() const;
+    const std::vector<double> &slopes() const;
+
+protected:
+    PiecewiseCubicInterpolant(std::vector<double> x, std::vector<double> y);
+    void setSlopes(std::vector<double> slopes);
+
+    std::vector<double> xi, yi;
+    std::vector<double> di;         // First derivative at each node
+    std::vector<double> ci, ei;         // Quadratic and cubic coefficients per interval
+    std::vector<double> areas;          // Integral from x_0 to x_i
+
+    size_t interval(double x) const;
+    double evaluateInterval(size_t i, double x) const;
+    double antiderivative(double x) const;
+    static std::vector<double> secants(const std::vector<double> &x, const std::vector<double> &y);
+};
+
+// C² cubic spline, slopes from one tridiagonal solve
+class CubicSplineInterpolant : public PiecewiseCubicInterpolant
+{
+public:
+    enum class Boundary
+    {
+        Natural,            // Zero second derivative at both ends
+        Clamped         // Prescribed first derivative at both ends
+    };
+
+    CubicSplineInterpolant(std::vector<double> x, std::vector<double> y, Boundary boundary = Boundary::Natural,
+                           double startSlope = 0.0, double endSlope = 0.0);
+
+    static double estimateStartSlope(const std::vector<double> &x, const std::vector<double> &y);
+    static double estimateEndSlope(const std::vector<double> &x, const std::vector<double> &y);
+};
+
+// Akima spline, slopes from a local weighting of neighbouring secants (no overshoot on outliers)
+class AkimaInterpolant : public PiecewiseCubicInterpolant
+{
+public:
+    AkimaInterpolant(std::vector<double> x, std::vector<double> y);
+};
+
+#endif //SPLINEINTERPOLANT_H
@@ -0,0 +1,69 @@
+#include "streaminginterpolant.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+StreamingInterpolant::StreamingInterpolant(size_t window)
+    : capacity(std::max<size_t>(window, 1))
+{}
+
+// Adds a measurement and drops the oldest one beyond the window; returns false, changing nothing,
+// for non-finite values or an x already inside the window
+bool StreamingInterpolant::append(double x,
+                                  double y)
+{
+    if (!std::isfinite(y) || !std::isfinite(x) || model.contains(x))
+        return false;
+
+    evict(capacity - 1);
+    model.insert(x, y);
+    arrivals.push_back(x);
+
+    return true;
+}
+
+// Drops every point
+void StreamingInterpolant::clear()
+{
+    model.clear();
+    arrivals.clear();
+}
+
+// Resizes the window, evicting the oldest points if it shrinks
+void StreamingInterpolant::setWindow(size_t window)
+{
+    capacity = std::max<size_t>(window, 1);
+    evict(capacity);
+}
+
+size_t StreamingInterpolant::window() const
+{
+    return capacity;
+}
+
+size_t StreamingInterpolant::size() const
+{
+    return arrivals.size();
+}
+
+// x-value of the latest accepted measurement, NaN while empty
+double StreamingInterpolant::newest() const
+{
+    return arrivals.empty() ? std::nan("") : arrivals.back();
+}
+
+// Immutable copy of the current window for evaluation, O(W)
+std::shared_ptr<const BarycentricInterpolant> StreamingInterpolant::snapshot() const
+{
+    return model.snapshot();
+}
+
+// Removes the oldest points until at most keep remain
+void StreamingInterpolant::evict(size_t keep)
+{
+    while (arrivals.size() > keep) {
+        model.remove(arrivals.front());
+        arrivals.pop_front();
+    }
+}
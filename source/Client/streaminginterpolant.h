@@ -0,0 +1,38 @@
+#ifndef STREAMINGINTERPOLANT_H
+#define STREAMINGINTERPOLANT_H
+
+#include "incrementalinterpolant.h"
+#include "interpolant.h"
+
+#include <deque>
+#include <memory>
+
+// Barycentric model over the most recent W points of a live feed.
+// Each append evicts the oldest point once the window is full; both are single-point edits of the
+// underlying IncrementalInterpolant, so a new measurement costs O(W) rather than an O(W²) rebuild.
+class StreamingInterpolant
+{
+public:
+    static constexpr size_t DefaultWindow = 8;          // Few nodes keep the sliding polynomial from ringing at its newest end
+
+    explicit StreamingInterpolant(size_t window = DefaultWindow);
+
+    bool append(double x, double y);
+    void clear();
+
+    void setWindow(size_t window);
+    size_t window() const;
+    size_t size() const;
+    double newest() const;
+
+    std::shared_ptr<const BarycentricInterpolant> snapshot() const;
+
+private:
+    IncrementalInterpolant model;
+    std::deque<double> arrivals;            // x-values in arrival order, the front is evicted next
+    size_t capacity;
+
+    void evict(size_t keep);
+};
+
+#endif //STREAMINGINTERPOLANT_H